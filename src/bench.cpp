@@ -0,0 +1,786 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Benchmark driver for the phases a model goes through: parsing and
+ * building, type checking, copying, writing, pretty printing and
+ * signal flow analysis. Traces can be decoded with the tracer utility as well.
+ *
+ * For every model and phase the wall and CPU time, the number and
+ * size of the allocations and the peak resident set size are written
+ * as JSON Lines, one record per line. Phases that fail on a model are
+ * recorded with the error instead. A previous result can be given as a
+ * baseline, in which case phases that got slower or use more memory
+ * are reported and the exit status is non-zero.
+ */
+
+#include "utap/utap.h"
+#include "utap/systembuilder.h"
+#include "utap/typechecker.h"
+#include "utap/prettyprinter.h"
+#include "utap/signalflow.h"
+
+#include <libxml/xmlmemory.h>
+
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <strings.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using UTAP::TimedAutomataSystem;
+using UTAP::SystemBuilder;
+using UTAP::TypeChecker;
+using UTAP::PrettyPrinter;
+using UTAP::SignalFlow;
+using UTAP::Partitioner;
+
+using std::vector;
+using std::string;
+using std::map;
+using std::ostream;
+using std::ostringstream;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+/*
+ * Allocations are counted by replacing the global operator new and
+ * the allocation functions of libxml2. The replacements are kept out
+ * of line, as GCC otherwise warns about operator new being paired
+ * with free.
+ */
+#ifdef __GNUC__
+#define OUT_OF_LINE __attribute__((noinline))
+#else
+#define OUT_OF_LINE
+#endif
+
+static size_t allocations = 0;
+static size_t allocated = 0;
+
+OUT_OF_LINE void *operator new(size_t size)
+{
+    allocations++;
+    allocated += size;
+    void *p = malloc(size ? size : 1);
+    if (p == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+OUT_OF_LINE void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+OUT_OF_LINE void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+OUT_OF_LINE void operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+OUT_OF_LINE void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+OUT_OF_LINE void operator delete[](void *p, size_t) noexcept
+{
+    free(p);
+}
+
+static void *xmlCountingMalloc(size_t size)
+{
+    allocations++;
+    allocated += size;
+    return malloc(size);
+}
+
+static void *xmlCountingRealloc(void *p, size_t size)
+{
+    allocations++;
+    allocated += size;
+    return realloc(p, size);
+}
+
+static char *xmlCountingStrdup(const char *s)
+{
+    allocations++;
+    allocated += strlen(s) + 1;
+    return strdup(s);
+}
+
+/** The resources used by one phase. */
+struct sample_t
+{
+    double wall = 0;      /**< seconds */
+    double cpu = 0;       /**< seconds of user and system time */
+    long allocations = -1; /**< -1 if unknown */
+    long allocated = -1;  /**< bytes, -1 if unknown */
+    long peak = 0;        /**< peak resident set size in kB */
+};
+
+struct record_t
+{
+    string model;
+    string phase;
+    sample_t sample;
+    string error;       /**< Why the phase failed, empty if it did not */
+};
+
+static double cpuTime(const struct rusage &usage)
+{
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6
+        + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+}
+
+/**
+ * Resets the peak resident set size of the process, so that the peak
+ * of each phase can be measured. Only supported by Linux.
+ */
+static void resetPeak()
+{
+    FILE *file = fopen("/proc/self/clear_refs", "w");
+    if (file)
+    {
+        fputs("5", file);
+        fclose(file);
+    }
+}
+
+static long peakRSS()
+{
+    FILE *file = fopen("/proc/self/status", "r");
+    if (file)
+    {
+        char line[256];
+        long peak = -1;
+        while (fgets(line, sizeof(line), file))
+        {
+            if (strncmp(line, "VmHWM:", 6) == 0)
+            {
+                peak = atol(line + 6);
+                break;
+            }
+        }
+        fclose(file);
+        if (peak >= 0)
+        {
+            return peak;
+        }
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/** Measures the resources used by the given function. */
+static sample_t measure(const std::function<void()> &phase)
+{
+    sample_t sample;
+    struct rusage before, after;
+
+    resetPeak();
+    size_t count = allocations;
+    size_t size = allocated;
+    getrusage(RUSAGE_SELF, &before);
+    auto start = std::chrono::steady_clock::now();
+
+    phase();
+
+    auto end = std::chrono::steady_clock::now();
+    getrusage(RUSAGE_SELF, &after);
+    sample.wall = std::chrono::duration<double>(end - start).count();
+    sample.cpu = cpuTime(after) - cpuTime(before);
+    sample.allocations = allocations - count;
+    sample.allocated = allocated - size;
+    sample.peak = peakRSS();
+    return sample;
+}
+
+/**
+ * Runs the tracer utility on an intermediate format file and a trace
+ * in a child process. Allocations cannot be counted in the child.
+ */
+static sample_t measureTracer(const string &tracer, const string &model,
+                              const string &trace)
+{
+    sample_t sample;
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        int null = open("/dev/null", O_WRONLY);
+        if (null >= 0)
+        {
+            dup2(null, STDOUT_FILENO);
+        }
+        execl(tracer.c_str(), tracer.c_str(), model.c_str(), trace.c_str(),
+              (char *)NULL);
+        perror(tracer.c_str());
+        _exit(127);
+    }
+    if (pid < 0)
+    {
+        throw std::runtime_error("Failed to start the tracer");
+    }
+
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) < 0)
+    {
+        throw std::runtime_error("Failed to wait for the tracer");
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        throw std::runtime_error("The tracer failed on " + trace);
+    }
+    sample.wall = std::chrono::duration<double>(end - start).count();
+    sample.cpu = cpuTime(usage);
+    sample.peak = usage.ru_maxrss;
+    return sample;
+}
+
+static bool isXML(const string &name)
+{
+    string base = name;
+    size_t length = base.length();
+    if (length > 3 && strcasecmp(".gz", base.c_str() + length - 3) == 0)
+    {
+        base.erase(length - 3);
+    }
+    else if (length > 4 && strcasecmp(".zst", base.c_str() + length - 4) == 0)
+    {
+        base.erase(length - 4);
+    }
+    length = base.length();
+    return length > 4 && strcasecmp(".xml", base.c_str() + length - 4) == 0;
+}
+
+/** Parses the model with the given builder. */
+static void parse(const string &name, UTAP::ParserBuilder *builder)
+{
+    if (isXML(name))
+    {
+        if (parseXMLFile(name.c_str(), builder, true) != 0)
+        {
+            throw std::runtime_error("Failed to read " + name);
+        }
+    }
+    else
+    {
+        FILE *file = fopen(name.c_str(), "r");
+        if (file == NULL)
+        {
+            throw std::runtime_error("Failed to open " + name);
+        }
+        parseXTA(file, builder, true);
+        fclose(file);
+    }
+}
+
+/**
+ * Returns the TRON style I/O specification of the partition phase:
+ * the first global channel is an input, the others are outputs.
+ */
+static string channels(TimedAutomataSystem &system)
+{
+    string inputs = "input";
+    string outputs = " output";
+    for (const UTAP::variable_t &variable : system.getGlobals().variables)
+    {
+        if (variable.uid.getType().isChannel())
+        {
+            (inputs == "input" ? inputs : outputs) += " " + variable.uid.getName();
+        }
+    }
+    return inputs + outputs;
+}
+
+/**
+ * Runs all phases on the model once. Problems with the model are
+ * reported unless quiet is set.
+ */
+static vector<record_t> run(const string &name, bool quiet)
+{
+    vector<record_t> records;
+    TimedAutomataSystem system;
+    std::ofstream null;
+    ostream &log = quiet ? null : cerr;
+
+    // Phases that do not support the model, e.g. the pretty printer
+    // on LSC charts, are recorded with the error
+    auto add = [&](const char *phase, const std::function<void()> &f) {
+        try
+        {
+            records.push_back(record_t { name, phase, measure(f) });
+        }
+        catch (std::exception &e)
+        {
+            log << name << ": " << phase << ": " << e.what() << endl;
+            records.push_back(record_t { name, phase, sample_t(), e.what() });
+        }
+    };
+
+    add("parse", [&]() {
+            SystemBuilder builder(&system);
+            parse(name, &builder);
+        });
+    if (system.hasErrors())
+    {
+        log << name << ": " << system.getErrors().size() << " errors"
+             << endl;
+        return records;
+    }
+    add("typecheck", [&]() {
+            TypeChecker checker(&system);
+            system.accept(checker);
+        });
+    if (system.hasErrors())
+    {
+        log << name << ": " << system.getErrors().size() << " errors"
+             << endl;
+        return records;
+    }
+    // Like the parsed system, the copy is destroyed after the phase
+    std::unique_ptr<TimedAutomataSystem> copy;
+    add("copy", [&]() {
+            copy.reset(new TimedAutomataSystem(system));
+        });
+    add("write", [&]() {
+            string buffer;
+            writeXMLBuffer(buffer, &system);
+        });
+    add("pretty", [&]() {
+            ostringstream out;
+            PrettyPrinter pretty(out);
+            parse(name, &pretty);
+        });
+    add("signalflow", [&]() {
+            ostringstream out;
+            SignalFlow flow(name.c_str(), system);
+            flow.printForDot(out, false, false, false);
+        });
+    string io = channels(system);
+    add("partition", [&]() {
+            ostringstream out;
+            std::istringstream in(io);
+            Partitioner partitioner(name.c_str(), system);
+            partitioner.partition(in);
+            partitioner.printForDot(out, false, false, false);
+        });
+    return records;
+}
+
+/**
+ * Combines repeated runs: the median of the times, and the maximum
+ * of the allocations and peak memory.
+ */
+static sample_t combine(vector<sample_t> samples)
+{
+    sample_t result;
+    size_t middle = samples.size() / 2;
+    std::sort(samples.begin(), samples.end(),
+              [](const sample_t &a, const sample_t &b) { return a.wall < b.wall; });
+    result.wall = samples[middle].wall;
+    std::sort(samples.begin(), samples.end(),
+              [](const sample_t &a, const sample_t &b) { return a.cpu < b.cpu; });
+    result.cpu = samples[middle].cpu;
+    for (const sample_t &s : samples)
+    {
+        result.allocations = std::max(result.allocations, s.allocations);
+        result.allocated = std::max(result.allocated, s.allocated);
+        result.peak = std::max(result.peak, s.peak);
+    }
+    return result;
+}
+
+static void writeString(ostream &out, const string &s)
+{
+    out << '"';
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out << '\\' << c;
+        }
+        else if (c == '\n')
+        {
+            out << "\\n";
+        }
+        else if ((unsigned char)c < 0x20)
+        {
+            out << ' ';
+        }
+        else
+        {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+static void writeNumber(ostream &out, long n)
+{
+    if (n < 0)
+    {
+        out << "null";
+    }
+    else
+    {
+        out << n;
+    }
+}
+
+static void writeRecords(ostream &out, const vector<record_t> &records)
+{
+    for (const record_t &r : records)
+    {
+        out << "{\"model\": ";
+        writeString(out, r.model);
+        out << ", \"phase\": ";
+        writeString(out, r.phase);
+        if (!r.error.empty())
+        {
+            out << ", \"error\": ";
+            writeString(out, r.error);
+            out << "}\n";
+            continue;
+        }
+        out << ", \"wall\": " << r.sample.wall
+            << ", \"cpu\": " << r.sample.cpu
+            << ", \"allocations\": ";
+        writeNumber(out, r.sample.allocations);
+        out << ", \"allocated\": ";
+        writeNumber(out, r.sample.allocated);
+        out << ", \"peak_rss\": " << r.sample.peak << "}\n";
+    }
+}
+
+/** Returns the string value of the given key in a record line. */
+static bool readString(const string &line, const char *key, string &value)
+{
+    string prefix = string("\"") + key + "\": \"";
+    size_t pos = line.find(prefix);
+    if (pos == string::npos)
+    {
+        return false;
+    }
+    value.clear();
+    for (pos += prefix.length(); pos < line.length() && line[pos] != '"'; pos++)
+    {
+        if (line[pos] == '\\' && pos + 1 < line.length())
+        {
+            pos++;
+        }
+        value += line[pos];
+    }
+    return true;
+}
+
+/** Returns the numeric value of the given key, -1 for null. */
+static double readNumber(const string &line, const char *key)
+{
+    string prefix = string("\"") + key + "\": ";
+    size_t pos = line.find(prefix);
+    if (pos == string::npos)
+    {
+        return -1;
+    }
+    const char *start = line.c_str() + pos + prefix.length();
+    char *end;
+    double value = strtod(start, &end);
+    return end == start ? -1 : value;
+}
+
+/** Reads records written by writeRecords. */
+static vector<record_t> readRecords(const char *name)
+{
+    std::ifstream file(name);
+    if (!file)
+    {
+        throw std::runtime_error(string("Failed to read ") + name);
+    }
+    vector<record_t> records;
+    string line;
+    while (std::getline(file, line))
+    {
+        record_t r;
+        if (readString(line, "model", r.model)
+            && readString(line, "phase", r.phase))
+        {
+            readString(line, "error", r.error);
+            r.sample.wall = readNumber(line, "wall");
+            r.sample.cpu = readNumber(line, "cpu");
+            r.sample.allocations = readNumber(line, "allocations");
+            r.sample.allocated = readNumber(line, "allocated");
+            r.sample.peak = readNumber(line, "peak_rss");
+            records.push_back(r);
+        }
+    }
+    return records;
+}
+
+/**
+ * Returns true if the current value exceeds the baseline by more than
+ * the threshold (in percent) and by more than the given slack, which
+ * keeps noise on tiny values from being reported.
+ */
+static bool worse(double base, double current, double threshold, double slack)
+{
+    return base >= 0 && current >= 0
+        && current > base * (1 + threshold / 100) && current - base > slack;
+}
+
+static void report(const record_t &r, const char *what, double base,
+                   double current)
+{
+    cerr << "REGRESSION " << r.model << " " << r.phase << " " << what
+         << ": " << base << " -> " << current;
+    if (base > 0)
+    {
+        cerr << " (+" << (current - base) / base * 100 << "%)";
+    }
+    cerr << endl;
+}
+
+/** Reports the phases that regressed. Returns the number of them. */
+static int compare(const vector<record_t> &baseline,
+                   const vector<record_t> &records, double threshold)
+{
+    map<std::pair<string, string>, sample_t> base;
+    for (const record_t &r : baseline)
+    {
+        if (!r.error.empty())
+        {
+            continue;
+        }
+        base[std::make_pair(r.model, r.phase)] = r.sample;
+    }
+
+    int regressions = 0;
+    for (const record_t &r : records)
+    {
+        auto it = base.find(std::make_pair(r.model, r.phase));
+        if (it == base.end() || !r.error.empty())
+        {
+            continue;
+        }
+        const sample_t &b = it->second;
+        bool regressed = false;
+        if (worse(b.wall, r.sample.wall, threshold, 0.001))
+        {
+            report(r, "wall", b.wall, r.sample.wall);
+            regressed = true;
+        }
+        if (worse(b.cpu, r.sample.cpu, threshold, 0.001))
+        {
+            report(r, "cpu", b.cpu, r.sample.cpu);
+            regressed = true;
+        }
+        if (worse(b.allocations, r.sample.allocations, threshold, 0))
+        {
+            report(r, "allocations", b.allocations, r.sample.allocations);
+            regressed = true;
+        }
+        if (worse(b.peak, r.sample.peak, threshold, 1024))
+        {
+            report(r, "peak_rss", b.peak, r.sample.peak);
+            regressed = true;
+        }
+        regressions += regressed;
+    }
+    return regressions;
+}
+
+void printHelp(const char* binary)
+{
+    cout <<
+        "Measures the phases of libutap on a corpus of models.\n"
+        "Usage:\n " << binary << " [options] model...\n"
+        "Options:\n"
+        "     -r <n>        repeat every model n times (default 3);\n"
+        "     -o <file>     write the results to file instead of stdout;\n"
+        "     -c <file>     compare with the results in file;\n"
+        "     -t <percent>  threshold for regressions (default 10);\n"
+        "     -x <if>,<xtr> decode the trace with the tracer utility;\n"
+        "     -T <tracer>   path of the tracer utility (default ./tracer).\n"
+        "Models are .xml (optionally .gz or .zst compressed) or .xta files.\n";
+}
+
+int main(int argc, char *argv[])
+{
+    xmlMemSetup(free, xmlCountingMalloc, xmlCountingRealloc,
+                xmlCountingStrdup);
+
+    int repeat = 3;
+    double threshold = 10;
+    const char *output = NULL;
+    const char *baseline = NULL;
+    string tracer = "./tracer";
+    vector<std::pair<string, string>> traces;
+    int c;
+
+    while ((c = getopt(argc, argv, "c:ho:r:t:T:x:")) != -1)
+    {
+        switch (c)
+        {
+        case 'c':
+            baseline = optarg;
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        case 'r':
+            repeat = std::max(1, atoi(optarg));
+            break;
+        case 't':
+            threshold = atof(optarg);
+            break;
+        case 'T':
+            tracer = optarg;
+            break;
+        case 'x':
+        {
+            const char *comma = strchr(optarg, ',');
+            if (comma == NULL)
+            {
+                cerr << "-x expects <if>,<xtr> argument.\n";
+                exit(EXIT_FAILURE);
+            }
+            traces.push_back(std::make_pair(string(optarg, comma - optarg),
+                                            string(comma + 1)));
+            break;
+        }
+        case 'h':
+        default:
+            printHelp(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (optind == argc && traces.empty())
+    {
+        printHelp(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    vector<record_t> records;
+    try
+    {
+        for (int i = optind; i < argc; i++)
+        {
+            vector<vector<record_t>> runs;
+            for (int k = 0; k < repeat; k++)
+            {
+                runs.push_back(run(argv[i], k > 0));
+            }
+            for (size_t p = 0; p < runs[0].size(); p++)
+            {
+                if (!runs[0][p].error.empty())
+                {
+                    records.push_back(runs[0][p]);
+                    continue;
+                }
+                vector<sample_t> samples;
+                for (const vector<record_t> &r : runs)
+                {
+                    samples.push_back(r[p].sample);
+                }
+                records.push_back(runs[0][p]);
+                records.back().sample = combine(samples);
+            }
+        }
+        for (const auto &trace : traces)
+        {
+            vector<sample_t> samples;
+            for (int k = 0; k < repeat; k++)
+            {
+                samples.push_back(measureTracer(tracer, trace.first,
+                                                trace.second));
+            }
+            record_t r { trace.second, "tracer", combine(samples) };
+            records.push_back(r);
+        }
+    }
+    catch (std::exception &e)
+    {
+        cerr << e.what() << endl;
+        return 1;
+    }
+
+    if (output)
+    {
+        std::ofstream file(output);
+        writeRecords(file, records);
+        if (!file)
+        {
+            perror(output);
+            return 1;
+        }
+    }
+    else
+    {
+        writeRecords(cout, records);
+    }
+
+    if (baseline)
+    {
+        try
+        {
+            if (compare(readRecords(baseline), records, threshold) > 0)
+            {
+                return 2;
+            }
+        }
+        catch (std::exception &e)
+        {
+            cerr << e.what() << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
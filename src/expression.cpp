@@ -25,6 +25,7 @@
 #include "utap/statement.h" // ExpressionVisitor for function call analysis
 
 #include <algorithm>
+#include <atomic>
 #include <stdexcept>
 #include <cassert>
 #include <cstring>
@@ -57,6 +58,7 @@ struct expression_t::expression_data
     symbol_t symbol;            /**< The symbol of the node */
     type_t type;                /**< The type of the expression */
     std::vector<expression_t> sub;/**< Subexpressions */
+    std::atomic<uint32_t> epoch{0};/**< Type checking epoch */
 //    expression_data(){}
     expression_data(position_t p, kind_t k, int32_t v):
         position(p), kind(k), value(v) {}
@@ -65,6 +67,7 @@ struct expression_t::expression_data
 expression_t::expression_t(kind_t kind, const position_t &pos)
 {
     data = std::make_shared<expression_data>(pos, kind, 0);
+    Statistics::record(Statistics::EXPRESSIONS, sizeof(expression_data));
 }
 
 expression_t::expression_t(const expression_t &e)
@@ -89,6 +92,23 @@ expression_t expression_t::clone() const
     return expr;
 }
 
+expression_t expression_t::rebuild(
+    const std::function<expression_t(expression_t)> &subs,
+    const std::function<symbol_t(symbol_t)> &symbols,
+    const std::function<type_t(type_t)> &types) const
+{
+    expression_t expr(data->kind, data->position);
+    std::memcpy(&expr.data->doubleValue, &data->doubleValue, sizeof(double));
+    expr.data->symbol = symbols(data->symbol);
+    expr.data->type = types(data->type);
+    expr.data->sub.reserve(data->sub.size());
+    for (const auto& s: data->sub)
+    {
+        expr.data->sub.push_back(s.empty() ? s : subs(s));
+    }
+    return expr;
+}
+
 expression_t expression_t::deeperClone() const
 {
     expression_t expr(data->kind, data->position);
@@ -620,6 +640,18 @@ void expression_t::setType(type_t type)
     data->type = type;
 }
 
+uint32_t expression_t::getEpoch() const
+{
+    assert(data);
+    return data->epoch.load(std::memory_order_acquire);
+}
+
+void expression_t::setEpoch(uint32_t epoch)
+{
+    assert(data);
+    data->epoch.store(epoch, std::memory_order_release);
+}
+
 int32_t expression_t::getValue() const
 {
     assert(data && data->kind == CONSTANT && data->type.isIntegral());
@@ -2045,12 +2077,12 @@ void expression_t::toString(bool old, char *&str, char *&end, int &size) const
     }
 }
 
-bool expression_t::operator < (const expression_t e) const
+bool expression_t::operator < (const expression_t &e) const
 {
     return data != NULL && e.data != NULL && data < e.data;
 }
 
-bool expression_t::operator == (const expression_t e) const
+bool expression_t::operator == (const expression_t &e) const
 {
     return data == e.data;
 }
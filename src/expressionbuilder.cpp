@@ -83,6 +83,11 @@ void ExpressionBuilder::handleWarning(const string& msg)
     system->addWarning(position, msg);
 }
 
+bool ExpressionBuilder::isAborted() const
+{
+    return system->isErrorLimitReached();
+}
+
 void ExpressionBuilder::pushFrame(frame_t frame)
 {
     frames.push(frame);
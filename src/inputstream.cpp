@@ -0,0 +1,232 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+#include "libparser.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+
+#ifdef ENABLE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace UTAP;
+
+/** Size of the blocks read from the file. */
+static const size_t BLOCK = 1 << 16;
+
+InputStream::InputStream(FILE *file)
+    : file(file), compression(NONE), in(new char[BLOCK]), inSize(0),
+      inPos(0), decoder(NULL), finished(false)
+{
+    fill();
+
+    const unsigned char *magic = (const unsigned char *)in;
+    if (inSize >= 2 && magic[0] == 0x1f && magic[1] == 0x8b)
+    {
+        compression = GZIP;
+#ifdef ENABLE_ZLIB
+        z_stream *z = new z_stream();
+        if (inflateInit2(z, 15 + 16) != Z_OK) // gzip header only
+        {
+            delete z;
+            delete[] in;
+            throw std::runtime_error("Failed to initialise gzip decoder");
+        }
+        decoder = z;
+#else
+        delete[] in;
+        throw std::runtime_error("No support for gzip compressed input");
+#endif
+    }
+    else if (inSize >= 4 && magic[0] == 0x28 && magic[1] == 0xb5
+             && magic[2] == 0x2f && magic[3] == 0xfd)
+    {
+        compression = ZSTD;
+#ifdef ENABLE_ZSTD
+        decoder = ZSTD_createDStream();
+        if (decoder == NULL
+            || ZSTD_isError(ZSTD_initDStream((ZSTD_DStream *)decoder)))
+        {
+            ZSTD_freeDStream((ZSTD_DStream *)decoder);
+            delete[] in;
+            throw std::runtime_error("Failed to initialise zstd decoder");
+        }
+#else
+        delete[] in;
+        throw std::runtime_error("No support for zstd compressed input");
+#endif
+    }
+}
+
+InputStream::~InputStream()
+{
+#ifdef ENABLE_ZLIB
+    if (compression == GZIP)
+    {
+        inflateEnd((z_stream *)decoder);
+        delete (z_stream *)decoder;
+    }
+#endif
+#ifdef ENABLE_ZSTD
+    if (compression == ZSTD)
+    {
+        ZSTD_freeDStream((ZSTD_DStream *)decoder);
+    }
+#endif
+    delete[] in;
+}
+
+/**
+ * Reads the next block of the file into the input buffer. Returns
+ * false at the end of the file.
+ */
+bool InputStream::fill()
+{
+    inSize = fread(in, 1, BLOCK, file);
+    inPos = 0;
+    if (inSize == 0 && ferror(file))
+    {
+        throw std::runtime_error("Failed to read input");
+    }
+    return inSize > 0;
+}
+
+size_t InputStream::read(char *buffer, size_t size)
+{
+    switch (compression)
+    {
+    case GZIP:
+        return inflate(buffer, size);
+    case ZSTD:
+        return decompress(buffer, size);
+    default:
+        if (inPos < inSize)
+        {
+            // Return what was read to detect the compression
+            size_t n = std::min(size, inSize - inPos);
+            memcpy(buffer, in + inPos, n);
+            inPos += n;
+            return n;
+        }
+        size_t n = fread(buffer, 1, size, file);
+        if (n == 0 && ferror(file))
+        {
+            throw std::runtime_error("Failed to read input");
+        }
+        return n;
+    }
+}
+
+/**
+ * Decodes gzip compressed input. A file may consist of several gzip
+ * members, which are decoded one after the other.
+ */
+size_t InputStream::inflate(char *buffer, size_t size)
+{
+#ifdef ENABLE_ZLIB
+    z_stream *z = (z_stream *)decoder;
+    z->next_out = (Bytef *)buffer;
+    z->avail_out = size;
+    for (;;)
+    {
+        if (finished && inPos < inSize)
+        {
+            inflateReset(z);
+            finished = false;
+        }
+        if (!finished)
+        {
+            z->next_in = (Bytef *)in + inPos;
+            z->avail_in = inSize - inPos;
+            int ret = ::inflate(z, Z_NO_FLUSH);
+            inPos = inSize - z->avail_in;
+            if (ret == Z_STREAM_END)
+            {
+                finished = true;
+            }
+            else if (ret != Z_OK && ret != Z_BUF_ERROR)
+            {
+                throw std::runtime_error("Invalid gzip compressed input");
+            }
+        }
+        if (z->avail_out < size)
+        {
+            return size - z->avail_out;
+        }
+        if (inPos == inSize && !fill())
+        {
+            if (!finished)
+            {
+                throw std::runtime_error("Truncated gzip compressed input");
+            }
+            return 0;
+        }
+    }
+#else
+    (void)buffer;
+    (void)size;
+    return 0;
+#endif
+}
+
+/** Decodes zstd compressed input, which may have several frames. */
+size_t InputStream::decompress(char *buffer, size_t size)
+{
+#ifdef ENABLE_ZSTD
+    ZSTD_outBuffer output = { buffer, size, 0 };
+    for (;;)
+    {
+        if (!finished || inPos < inSize)
+        {
+            ZSTD_inBuffer input = { in, inSize, inPos };
+            size_t ret = ZSTD_decompressStream((ZSTD_DStream *)decoder,
+                                               &output, &input);
+            if (ZSTD_isError(ret))
+            {
+                throw std::runtime_error("Invalid zstd compressed input");
+            }
+            inPos = input.pos;
+            finished = (ret == 0);
+        }
+        if (output.pos > 0)
+        {
+            return output.pos;
+        }
+        if (inPos == inSize && !fill())
+        {
+            if (!finished)
+            {
+                throw std::runtime_error("Truncated zstd compressed input");
+            }
+            return 0;
+        }
+    }
+#else
+    (void)buffer;
+    (void)size;
+    return 0;
+#endif
+}
@@ -37,7 +37,7 @@ std::string PositionTracker::path;
 
 namespace UTAP
 {
-  void PositionTracker::setPath(UTAP::ParserBuilder *parser, std::string s) {
+  void PositionTracker::setPath(UTAP::ParserBuilder *parser, const std::string &s) {
 
     // Incrementing the position by one avoids the problem where the
     // end-position happens to bleed into a path. E.g. the range 5-10
@@ -23,6 +23,7 @@
 #define UTAP_LIBPARSER_HH
 
 #include <functional>
+#include <cstdio>
     
 #include "utap/builder.h"
 
@@ -74,7 +75,7 @@ namespace UTAP
          * content). Adds position to \a builder and increments it by
          * 1.
          */
-        static void setPath(ParserBuilder *builder, std::string s);
+        static void setPath(ParserBuilder *builder, const std::string &s);
 
         /**
          * Sets the position of \a builder to [position, position + n)
@@ -88,6 +89,49 @@ namespace UTAP
          */
         static void newline(ParserBuilder *builder, int n);
     };
+
+    /**
+     * Reads a file which may be compressed with gzip or zstd. The
+     * compression is detected from the first bytes of the file, and
+     * compressed files are decoded a block at a time while they are
+     * read. Other files are read as they are.
+     */
+    class InputStream
+    {
+    public:
+        enum compression_t { NONE, GZIP, ZSTD };
+
+        /** Starts reading the file at its current position. */
+        InputStream(FILE *file);
+        ~InputStream();
+
+        /** Returns the compression of the file. */
+        compression_t getCompression() const { return compression; }
+
+        /**
+         * Reads up to \a size decoded bytes into \a buffer. Returns
+         * the number of bytes read, which is 0 only at the end of
+         * the file. Throws std::runtime_error if the file cannot be
+         * read or decoded.
+         */
+        size_t read(char *buffer, size_t size);
+
+    private:
+        FILE *file;
+        compression_t compression;
+        char *in;          /**< Buffered input from the file. */
+        size_t inSize;     /**< Number of bytes in the input buffer. */
+        size_t inPos;      /**< Next byte of the input buffer to use. */
+        void *decoder;     /**< The zlib or zstd decoder state. */
+        bool finished;     /**< True if the last frame has ended. */
+
+        InputStream(const InputStream &);
+        InputStream &operator=(const InputStream &);
+
+        bool fill();
+        size_t inflate(char *buffer, size_t size);
+        size_t decompress(char *buffer, size_t size);
+    };
 }
 
 #endif
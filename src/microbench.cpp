@@ -0,0 +1,450 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Micro benchmarks of the primitives that dominate the time spent
+ * in the parser and the type checker: symbol lookup, creating,
+ * copying and traversing expressions, type queries and position
+ * lookup. Every benchmark is run for a number of sizes, e.g. the
+ * number of symbols in a frame or nodes in an expression, and the
+ * time per operation is written as JSON, one record per line.
+ */
+
+#include "utap/symbols.h"
+#include "utap/expression.h"
+#include "utap/type.h"
+#include "utap/position.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace UTAP;
+using namespace UTAP::Constants;
+
+using std::vector;
+using std::string;
+using std::set;
+using std::ostream;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+/** Results are added to this, so that no work is optimised away. */
+static volatile size_t sink = 0;
+
+/**
+ * A benchmark prepares its data for a given size and returns the
+ * operation to measure. The operation is run the given number of
+ * times.
+ */
+typedef std::function<void(size_t)> operation_t;
+typedef std::function<operation_t(size_t)> benchmark_t;
+
+struct entry_t
+{
+    const char *name;
+    benchmark_t benchmark;
+};
+
+static string symbolName(size_t i)
+{
+    std::ostringstream name;
+    name << "v" << i;
+    return name.str();
+}
+
+static type_t intType()
+{
+    return type_t::createRange(type_t::createPrimitive(INT),
+                               expression_t::createConstant(-100),
+                               expression_t::createConstant(100));
+}
+
+/** Returns a frame with n integer variables. */
+static frame_t makeFrame(size_t n, frame_t frame = frame_t::createFrame())
+{
+    type_t type = intType();
+    for (size_t i = 0; i < n; i++)
+    {
+        frame.addSymbol(symbolName(i), type);
+    }
+    return frame;
+}
+
+/**
+ * Returns a balanced tree of n leaves combined with the given
+ * operator. Every other leaf is a variable of the frame.
+ */
+static expression_t makeTree(frame_t frame, size_t first, size_t last,
+                             kind_t kind = PLUS)
+{
+    if (last - first == 1)
+    {
+        if (first % 2 == 0)
+        {
+            return expression_t::createIdentifier(frame[first % frame.getSize()]);
+        }
+        return expression_t::createConstant(first);
+    }
+    size_t middle = (first + last) / 2;
+    return expression_t::createBinary(kind, makeTree(frame, first, middle, kind),
+                                      makeTree(frame, middle, last, kind));
+}
+
+/** Returns n type definitions of integers with up to three prefixes. */
+static vector<type_t> makeTypes(size_t n)
+{
+    vector<type_t> types;
+    for (size_t i = 0; i < n; i++)
+    {
+        type_t type = intType();
+        for (size_t k = 0; k < i % 4; k++)
+        {
+            type = type.createPrefix(k % 2 ? CONSTANT : SYSTEM_META);
+        }
+        types.push_back(type_t::createTypeDef(symbolName(i), type));
+    }
+    return types;
+}
+
+/** Returns a sequence of n assignments to the variables of the frame. */
+static expression_t makeAssignments(frame_t frame, size_t n)
+{
+    expression_t expr;
+    for (size_t i = 0; i < n; i++)
+    {
+        expression_t assign = expression_t::createBinary(
+            ASSIGN, expression_t::createIdentifier(frame[i % frame.getSize()]),
+            expression_t::createConstant(i));
+        expr = expr.empty() ? assign : expression_t::createBinary(COMMA, expr, assign);
+    }
+    return expr;
+}
+
+static const entry_t benchmarks[] =
+{
+    { "frame_t::resolve", [](size_t n) -> operation_t {
+            // Half of the names are found in the parent frame, which
+            // must be kept alive as frames do not own their parents
+            frame_t parent = makeFrame(n);
+            frame_t frame = frame_t::createFrame(parent);
+            type_t type = intType();
+            for (size_t i = 0; i < n; i++)
+            {
+                frame.addSymbol("l" + symbolName(i), type);
+            }
+            vector<string> names;
+            for (size_t i = 0; i < n; i++)
+            {
+                names.push_back((i % 2 ? "l" : "") + symbolName(i));
+            }
+            return [frame, parent, names, n](size_t iterations) mutable {
+                symbol_t symbol;
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += frame.resolve(names[i % n], symbol);
+                }
+            };
+        } },
+    { "frame_t::getIndexOf(name)", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            vector<string> names;
+            for (size_t i = 0; i < n; i++)
+            {
+                names.push_back(symbolName(i));
+            }
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += frame.getIndexOf(names[i % n]);
+                }
+            };
+        } },
+    { "frame_t::getIndexOf(symbol)", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += frame.getIndexOf(frame[i % n]);
+                }
+            };
+        } },
+    { "symbol_t::getName", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += frame[i % n].getName().size();
+                }
+            };
+        } },
+    { "expression_t::createBinary", [](size_t n) -> operation_t {
+            // Builds chains of n nodes
+            frame_t frame = makeFrame(1);
+            return [=](size_t iterations) {
+                expression_t expr = expression_t::createIdentifier(frame[0]);
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    if (i % n == 0)
+                    {
+                        expr = expression_t::createIdentifier(frame[0]);
+                    }
+                    expr = expression_t::createBinary(
+                        PLUS, expr, expression_t::createConstant(i));
+                }
+                sink += expr.getSize();
+            };
+        } },
+    { "expression_t copy", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            vector<expression_t> exprs;
+            for (size_t i = 0; i < n; i++)
+            {
+                exprs.push_back(expression_t::createIdentifier(frame[i]));
+            }
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    expression_t copy = exprs[i % n];
+                    sink += copy.getSize();
+                }
+            };
+        } },
+    { "expression_t::deeperClone", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            expression_t expr = makeTree(frame, 0, n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += expr.deeperClone().getSize();
+                }
+            };
+        } },
+    { "expression_t::subst", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            expression_t expr = makeTree(frame, 0, n);
+            expression_t value = expression_t::createConstant(1);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += expr.subst(frame[0], value).getSize();
+                }
+            };
+        } },
+    { "expression_t::toString", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            expression_t expr = makeTree(frame, 0, n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += expr.toString().size();
+                }
+            };
+        } },
+    { "type_t::is", [](size_t n) -> operation_t {
+            vector<type_t> types = makeTypes(n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += types[i % n].is(INT);
+                }
+            };
+        } },
+    { "type_t::strip", [](size_t n) -> operation_t {
+            vector<type_t> types = makeTypes(n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += types[i % n].strip().getKind();
+                }
+            };
+        } },
+    { "expression_t::collectPossibleReads", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            expression_t expr = makeTree(frame, 0, n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    set<symbol_t> symbols;
+                    expr.collectPossibleReads(symbols);
+                    sink += symbols.size();
+                }
+            };
+        } },
+    { "expression_t::collectPossibleWrites", [](size_t n) -> operation_t {
+            frame_t frame = makeFrame(n);
+            expression_t expr = makeAssignments(frame, n);
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    set<symbol_t> symbols;
+                    expr.collectPossibleWrites(symbols);
+                    sink += symbols.size();
+                }
+            };
+        } },
+    { "Positions::find", [](size_t n) -> operation_t {
+            // n lines of 40 characters
+            Positions positions;
+            for (size_t i = 0; i < n; i++)
+            {
+                positions.add(i * 40, i * 40, i + 1, "");
+            }
+            return [=](size_t iterations) {
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    sink += positions.find((i * 7919) % (n * 40)).line;
+                }
+            };
+        } },
+};
+
+/**
+ * Runs the operation with a growing number of iterations until it
+ * takes at least the given time. Returns the time per iteration in
+ * nanoseconds.
+ */
+static double measure(const operation_t &operation, double minTime,
+                      size_t &iterations)
+{
+    for (iterations = 1; ; iterations *= 2)
+    {
+        auto start = std::chrono::steady_clock::now();
+        operation(iterations);
+        auto end = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(end - start).count();
+        if (elapsed >= minTime || iterations >= (size_t(1) << 40))
+        {
+            return elapsed * 1e9 / iterations;
+        }
+    }
+}
+
+void printHelp(const char* binary)
+{
+    cout <<
+        "Runs micro benchmarks of the libutap primitives.\n"
+        "Usage:\n " << binary << " [options]\n"
+        "Options:\n"
+        "     -f <text>     only run benchmarks whose name contains text;\n"
+        "     -n <sizes>    comma separated sizes (default 10,100,1000,10000);\n"
+        "     -m <seconds>  minimum time per measurement (default 0.1);\n"
+        "     -o <file>     write the results to file instead of stdout;\n"
+        "     -l            list the benchmarks.\n";
+}
+
+int main(int argc, char *argv[])
+{
+    const char *filter = "";
+    const char *output = NULL;
+    vector<size_t> sizes = { 10, 100, 1000, 10000 };
+    double minTime = 0.1;
+    int c;
+
+    while ((c = getopt(argc, argv, "f:hlm:n:o:")) != -1)
+    {
+        switch (c)
+        {
+        case 'f':
+            filter = optarg;
+            break;
+        case 'l':
+            for (const entry_t &entry : benchmarks)
+            {
+                cout << entry.name << endl;
+            }
+            return 0;
+        case 'm':
+            minTime = atof(optarg);
+            break;
+        case 'n':
+        {
+            sizes.clear();
+            std::istringstream in(optarg);
+            string size;
+            while (std::getline(in, size, ','))
+            {
+                long n = atol(size.c_str());
+                if (n <= 0)
+                {
+                    cerr << "Invalid size: " << size << endl;
+                    exit(EXIT_FAILURE);
+                }
+                sizes.push_back(n);
+            }
+            break;
+        }
+        case 'o':
+            output = optarg;
+            break;
+        case 'h':
+        default:
+            printHelp(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    std::ofstream file;
+    if (output)
+    {
+        file.open(output);
+        if (!file)
+        {
+            perror(output);
+            return 1;
+        }
+    }
+    ostream &out = output ? file : cout;
+
+    bool first = true;
+    out << "[\n";
+    for (const entry_t &entry : benchmarks)
+    {
+        if (strstr(entry.name, filter) == NULL)
+        {
+            continue;
+        }
+        for (size_t size : sizes)
+        {
+            size_t iterations;
+            double time = measure(entry.benchmark(size), minTime, iterations);
+            out << (first ? "" : ",\n")
+                << "{\"benchmark\": \"" << entry.name << "\""
+                << ", \"size\": " << size
+                << ", \"iterations\": " << iterations
+                << ", \"ns_per_op\": " << time << "}";
+            first = false;
+        }
+    }
+    out << "\n]\n";
+    out.flush();
+    return out ? 0 : 1;
+}
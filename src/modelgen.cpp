@@ -0,0 +1,779 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Generates synthetic models of a given shape, e.g. for measuring
+ * the performance of the parser, the type checker and the writer on
+ * models much larger than those found in practice. The same options
+ * and seed always produce the same model.
+ */
+
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+using std::vector;
+using std::string;
+using std::ostream;
+using std::ostringstream;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+/** The shape of the generated model. */
+struct options_t
+{
+    unsigned templates = 2;
+    unsigned locations = 5;
+    unsigned edges = 10;
+    unsigned clocks = 1;
+    unsigned ints = 4;
+    unsigned arrays = 2;
+    unsigned size = 4;
+    unsigned channels = 3;
+    unsigned functions = 2;
+    unsigned selects = 25;
+    unsigned processes = 4;
+    unsigned queries = 0;
+    unsigned charts = 0;
+};
+
+struct edge_t
+{
+    unsigned source;
+    unsigned target;
+    string select;
+    string guard;
+    string sync;
+    string assign;
+};
+
+struct template_t
+{
+    string name;
+    string declaration;
+    vector<string> invariants;
+    vector<edge_t> edges;
+};
+
+struct message_t
+{
+    unsigned source;
+    unsigned target;
+    unsigned location;
+    string label;
+};
+
+struct anchored_t
+{
+    unsigned anchor;
+    unsigned location;
+    string label;
+};
+
+struct chart_t
+{
+    string name;
+    bool universal;
+    unsigned prechart;          /**< bottom of the prechart, 0 if none */
+    vector<unsigned> instances; /**< indices of the processes */
+    vector<message_t> messages;
+    vector<anchored_t> conditions;
+    vector<anchored_t> updates;
+};
+
+/**
+ * The model is generated into memory first, so that both output
+ * formats are written from the same random choices.
+ */
+class Generator
+{
+private:
+    const options_t &options;
+    std::mt19937 rng;
+    string declaration;
+    vector<template_t> templates;
+    string system;
+    vector<string> queries;
+    vector<chart_t> charts;
+
+    /** Returns a number in [0, n). Deterministic on all platforms. */
+    unsigned pick(unsigned n) { return n == 0 ? 0 : rng() % n; }
+
+    /** Returns true with the given percentage. */
+    bool chance(unsigned percent) { return pick(100) < percent; }
+
+    /** Returns the kind of channel k: chan, broadcast chan or array. */
+    static unsigned channelKind(unsigned k) { return k % 3; }
+
+    string channel(unsigned k, const string &index) const;
+    void generateDeclarations();
+    void generateFunction(ostream &out, unsigned k);
+    string generateGuard(const string &index, bool clocks);
+    string generateUpdate(const string &index);
+    void generateTemplate(unsigned k);
+    void generateSystem();
+    void generateQueries();
+    void generateChart(unsigned k);
+public:
+    Generator(const options_t &options, unsigned seed);
+
+    void writeXTA(ostream &out) const;
+    void writeXML(ostream &out) const;
+};
+
+Generator::Generator(const options_t &options, unsigned seed)
+    : options(options), rng(seed)
+{
+    generateDeclarations();
+    for (unsigned k = 0; k < options.templates; k++)
+    {
+        generateTemplate(k);
+    }
+    generateSystem();
+    generateQueries();
+    for (unsigned k = 0; k < options.charts; k++)
+    {
+        generateChart(k);
+    }
+}
+
+string Generator::channel(unsigned k, const string &index) const
+{
+    ostringstream out;
+    out << "c" << k;
+    if (channelKind(k) == 2)
+    {
+        out << "[" << index << "]";
+    }
+    return out.str();
+}
+
+void Generator::generateDeclarations()
+{
+    ostringstream out;
+    out << "// Generated model\n"
+        << "const int N = " << options.size << ";\n"
+        << "typedef int[0,N-1] id_t;\n";
+    for (unsigned k = 0; k < options.ints; k++)
+    {
+        out << "int[-100,100] v" << k << " = " << pick(10) << ";\n";
+    }
+    for (unsigned k = 0; k < options.arrays; k++)
+    {
+        out << "int a" << k << "[N];\n";
+    }
+    for (unsigned k = 0; k < options.channels; k++)
+    {
+        switch (channelKind(k))
+        {
+        case 0:
+            out << "chan c" << k << ";\n";
+            break;
+        case 1:
+            out << "broadcast chan c" << k << ";\n";
+            break;
+        default:
+            out << "chan c" << k << "[N];\n";
+            break;
+        }
+    }
+    for (unsigned k = 0; k < options.functions; k++)
+    {
+        generateFunction(out, k);
+    }
+    declaration = out.str();
+}
+
+void Generator::generateFunction(ostream &out, unsigned k)
+{
+    out << "\nint f" << k << "(int x)\n"
+        << "{\n"
+        << "    int r = " << pick(10) << ";\n"
+        << "    for (i : id_t) {\n";
+    if (options.arrays > 0)
+    {
+        out << "        r = r + a" << pick(options.arrays) << "[i] * x;\n";
+    }
+    else
+    {
+        out << "        r = r + i * x;\n";
+    }
+    out << "    }\n"
+        << "    while (r > 100 || r < -100) {\n"
+        << "        r = r / 2;\n"
+        << "    }\n";
+    if (k > 0 && chance(50))
+    {
+        out << "    r = r + f" << pick(k) << "(x);\n";
+    }
+    out << "    return r;\n"
+        << "}\n";
+}
+
+string Generator::generateGuard(const string &index, bool clocks)
+{
+    ostringstream out;
+    if (clocks && options.clocks > 0 && chance(50))
+    {
+        out << "x" << pick(options.clocks) << " >= " << pick(5);
+    }
+    if (options.ints > 0 && chance(50))
+    {
+        if (!out.str().empty())
+        {
+            out << " && ";
+        }
+        out << "v" << pick(options.ints) << " < " << pick(100);
+    }
+    if (options.arrays > 0 && chance(50))
+    {
+        if (!out.str().empty())
+        {
+            out << " && ";
+        }
+        out << "a" << pick(options.arrays) << "[" << index << "] <= "
+            << pick(10);
+    }
+    return out.str();
+}
+
+string Generator::generateUpdate(const string &index)
+{
+    ostringstream out;
+    if (options.clocks > 0 && chance(50))
+    {
+        out << "x" << pick(options.clocks) << " = 0";
+    }
+    if (options.ints > 0 && chance(50))
+    {
+        if (!out.str().empty())
+        {
+            out << ", ";
+        }
+        unsigned v = pick(options.ints);
+        out << "v" << v << " = (v" << v << " + 1) % 100";
+    }
+    if (options.arrays > 0 && chance(50))
+    {
+        if (!out.str().empty())
+        {
+            out << ", ";
+        }
+        out << "a" << pick(options.arrays) << "[" << index << "] = ";
+        if (options.functions > 0)
+        {
+            out << "f" << pick(options.functions) << "(pid)";
+        }
+        else
+        {
+            out << pick(10);
+        }
+    }
+    return out.str();
+}
+
+void Generator::generateTemplate(unsigned k)
+{
+    template_t t;
+    ostringstream name;
+    name << "T" << k;
+    t.name = name.str();
+
+    ostringstream out;
+    if (options.clocks > 0)
+    {
+        out << "clock ";
+        for (unsigned i = 0; i < options.clocks; i++)
+        {
+            out << (i > 0 ? ", x" : "x") << i;
+        }
+        out << ";\n";
+    }
+    out << "int[0,10] count;\n";
+    t.declaration = out.str();
+
+    unsigned locations = options.locations > 0 ? options.locations : 1;
+    for (unsigned i = 0; i < locations; i++)
+    {
+        if (options.clocks > 0 && i % 2 == 0)
+        {
+            t.invariants.push_back("x0 <= 10");
+        }
+        else
+        {
+            t.invariants.push_back("");
+        }
+    }
+
+    for (unsigned i = 0; i < options.edges; i++)
+    {
+        edge_t e;
+        // The first edges form a cycle through all locations
+        e.source = i < locations ? i : pick(locations);
+        e.target = i < locations ? (i + 1) % locations : pick(locations);
+
+        string index = "pid";
+        if (chance(options.selects))
+        {
+            e.select = "s : id_t";
+            index = "s";
+        }
+
+        bool clocks = true;
+        if (options.channels > 0 && chance(50))
+        {
+            unsigned c = pick(options.channels);
+            bool receive = chance(50);
+            e.sync = channel(c, index) + (receive ? "?" : "!");
+            // Clock guards are not allowed on broadcast receivers
+            clocks = !(receive && channelKind(c) == 1);
+        }
+
+        e.guard = generateGuard(index, clocks);
+        if (!clocks && e.guard.empty())
+        {
+            // Broadcast receivers should not have a trivial guard
+            e.guard = index + " >= 0";
+        }
+        e.assign = generateUpdate(index);
+        t.edges.push_back(e);
+    }
+    templates.push_back(t);
+}
+
+void Generator::generateSystem()
+{
+    ostringstream out;
+    for (unsigned i = 0; i < options.processes; i++)
+    {
+        out << "P" << i << " = T" << i % options.templates << "("
+            << i % options.size << ");\n";
+    }
+    out << "system ";
+    for (unsigned i = 0; i < options.processes; i++)
+    {
+        out << (i > 0 ? ", P" : "P") << i;
+    }
+    out << ";\n";
+    system = out.str();
+}
+
+void Generator::generateQueries()
+{
+    for (unsigned i = 0; i < options.queries; i++)
+    {
+        ostringstream out;
+        switch (pick(3))
+        {
+        case 0:
+            out << "A[] not deadlock";
+            break;
+        case 1:
+            out << "E<> P" << pick(options.processes)
+                << ".L" << pick(options.locations);
+            break;
+        default:
+            out << "A[] P" << pick(options.processes) << ".count <= 10";
+            break;
+        }
+        queries.push_back(out.str());
+    }
+}
+
+void Generator::generateChart(unsigned k)
+{
+    chart_t c;
+    ostringstream name;
+    name << "Chart" << k;
+    c.name = name.str();
+    c.universal = chance(50);
+
+    unsigned instances = std::min(options.processes, 3u);
+    for (unsigned i = 0; i < instances; i++)
+    {
+        c.instances.push_back(pick(options.processes));
+    }
+
+    unsigned location = 0;
+    for (unsigned i = 0; i < 3 && options.channels > 0; i++)
+    {
+        message_t m;
+        m.source = pick(instances);
+        m.target = pick(instances);
+        m.location = location++;
+        m.label = channel(pick(options.channels), "0");
+        c.messages.push_back(m);
+    }
+    c.prechart = c.universal ? location : 0;
+
+    anchored_t condition;
+    condition.anchor = pick(instances);
+    condition.location = location++;
+    if (options.ints > 0)
+    {
+        ostringstream out;
+        out << "v" << pick(options.ints) << " > " << pick(10);
+        condition.label = out.str();
+    }
+    else
+    {
+        condition.label = "true";
+    }
+    c.conditions.push_back(condition);
+
+    if (options.ints > 0)
+    {
+        anchored_t update;
+        update.anchor = pick(instances);
+        update.location = location++;
+        ostringstream out;
+        out << "v" << pick(options.ints) << " = " << pick(10);
+        update.label = out.str();
+        c.updates.push_back(update);
+    }
+    charts.push_back(c);
+}
+
+void Generator::writeXTA(ostream &out) const
+{
+    out << declaration << "\n";
+    for (const template_t &t : templates)
+    {
+        out << "process " << t.name << "(const id_t pid)\n"
+            << "{\n"
+            << t.declaration
+            << "state\n";
+        for (size_t i = 0; i < t.invariants.size(); i++)
+        {
+            out << "    L" << i;
+            if (!t.invariants[i].empty())
+            {
+                out << " { " << t.invariants[i] << " }";
+            }
+            out << (i + 1 < t.invariants.size() ? ",\n" : ";\n");
+        }
+        out << "init L0;\n";
+        if (!t.edges.empty())
+        {
+            out << "trans\n";
+        }
+        for (size_t i = 0; i < t.edges.size(); i++)
+        {
+            const edge_t &e = t.edges[i];
+            out << "    L" << e.source << " -> L" << e.target << " {";
+            if (!e.select.empty())
+            {
+                out << " select " << e.select << ";";
+            }
+            if (!e.guard.empty())
+            {
+                out << " guard " << e.guard << ";";
+            }
+            if (!e.sync.empty())
+            {
+                out << " sync " << e.sync << ";";
+            }
+            if (!e.assign.empty())
+            {
+                out << " assign " << e.assign << ";";
+            }
+            out << " }" << (i + 1 < t.edges.size() ? ",\n" : ";\n");
+        }
+        out << "}\n\n";
+    }
+    out << system;
+}
+
+/** Writes text with the XML special characters escaped. */
+static void escape(ostream &out, const string &text)
+{
+    for (char c : text)
+    {
+        switch (c)
+        {
+        case '<':
+            out << "&lt;";
+            break;
+        case '>':
+            out << "&gt;";
+            break;
+        case '&':
+            out << "&amp;";
+            break;
+        default:
+            out << c;
+        }
+    }
+}
+
+static void label(ostream &out, const char *kind, const string &text)
+{
+    if (!text.empty())
+    {
+        out << "<label kind=\"" << kind << "\">";
+        escape(out, text);
+        out << "</label>";
+    }
+}
+
+void Generator::writeXML(ostream &out) const
+{
+    unsigned id = 0;
+
+    out << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+        << "<!DOCTYPE nta PUBLIC '-//Uppaal Team//DTD Flat System 1.1//EN'"
+        << " 'http://www.it.uu.se/research/group/darts/uppaal/flat-1_2.dtd'>\n"
+        << "<nta>\n"
+        << "<declaration>";
+    escape(out, declaration);
+    out << "</declaration>\n";
+
+    for (const template_t &t : templates)
+    {
+        unsigned first = id;
+        out << "<template>\n"
+            << "<name>" << t.name << "</name>\n"
+            << "<parameter>const id_t pid</parameter>\n"
+            << "<declaration>";
+        escape(out, t.declaration);
+        out << "</declaration>\n";
+        for (size_t i = 0; i < t.invariants.size(); i++)
+        {
+            out << "<location id=\"id" << id++ << "\">"
+                << "<name>L" << i << "</name>";
+            label(out, "invariant", t.invariants[i]);
+            out << "</location>\n";
+        }
+        out << "<init ref=\"id" << first << "\"/>\n";
+        for (const edge_t &e : t.edges)
+        {
+            out << "<transition>"
+                << "<source ref=\"id" << first + e.source << "\"/>"
+                << "<target ref=\"id" << first + e.target << "\"/>";
+            label(out, "select", e.select);
+            label(out, "guard", e.guard);
+            label(out, "synchronisation", e.sync);
+            label(out, "assignment", e.assign);
+            out << "</transition>\n";
+        }
+        out << "</template>\n";
+    }
+
+    for (const chart_t &c : charts)
+    {
+        unsigned first = id;
+        out << "<lsc>\n"
+            << "<name>" << c.name << "</name>\n"
+            << "<type>" << (c.universal ? "Universal" : "Existential")
+            << "</type>\n"
+            << "<mode>Invariant</mode>\n"
+            << "<declaration></declaration>\n";
+        for (unsigned i : c.instances)
+        {
+            out << "<instance id=\"id" << id++ << "\">"
+                << "<name>P" << i << "</name></instance>\n";
+        }
+        if (c.prechart > 0)
+        {
+            out << "<prechart id=\"id" << id++ << "\">"
+                << "<lsclocation>" << c.prechart << "</lsclocation>"
+                << "</prechart>\n";
+        }
+        for (const message_t &m : c.messages)
+        {
+            out << "<message id=\"id" << id++ << "\">"
+                << "<source ref=\"id" << first + m.source << "\"/>"
+                << "<target ref=\"id" << first + m.target << "\"/>"
+                << "<lsclocation>" << m.location << "</lsclocation>";
+            label(out, "message", m.label);
+            out << "</message>\n";
+        }
+        for (const anchored_t &a : c.conditions)
+        {
+            out << "<condition id=\"id" << id++ << "\">"
+                << "<anchor instanceid=\"id" << first + a.anchor << "\"/>"
+                << "<lsclocation>" << a.location << "</lsclocation>"
+                << "<temperature>hot</temperature>";
+            label(out, "condition", a.label);
+            out << "</condition>\n";
+        }
+        for (const anchored_t &a : c.updates)
+        {
+            out << "<update id=\"id" << id++ << "\">"
+                << "<anchor instanceid=\"id" << first + a.anchor << "\"/>"
+                << "<lsclocation>" << a.location << "</lsclocation>";
+            label(out, "update", a.label);
+            out << "</update>\n";
+        }
+        out << "</lsc>\n";
+    }
+
+    out << "<system>";
+    escape(out, system);
+    out << "</system>\n";
+
+    if (!queries.empty())
+    {
+        out << "<queries>\n";
+        for (const string &q : queries)
+        {
+            out << "<query><formula>";
+            escape(out, q);
+            out << "</formula><comment></comment></query>\n";
+        }
+        out << "</queries>\n";
+    }
+    out << "</nta>\n";
+}
+
+void printHelp(const char* binary)
+{
+    cout <<
+        "Generates a synthetic UPPAAL model of the given shape.\n"
+        "Usage:\n " << binary << " [options] [output]\n"
+        "Options:\n"
+        "     -f <xml|xta>  output format (default xml);\n"
+        "     -s <seed>     seed of the random choices (default 1);\n"
+        "     -t <n>        number of templates (default 2);\n"
+        "     -l <n>        locations per template (default 5);\n"
+        "     -e <n>        edges per template (default 10);\n"
+        "     -c <n>        clocks per template (default 1);\n"
+        "     -i <n>        bounded integer variables (default 4);\n"
+        "     -a <n>        integer arrays (default 2);\n"
+        "     -n <n>        size of the arrays and of id_t (default 4);\n"
+        "     -C <n>        channels, cycling between chan, broadcast chan\n"
+        "                   and channel arrays (default 3);\n"
+        "     -F <n>        functions with loops (default 2);\n"
+        "     -S <percent>  edges with a select parameter (default 25);\n"
+        "     -p <n>        process instances (default 4);\n"
+        "     -q <n>        queries, XML only (default 0);\n"
+        "     -L <n>        LSC charts, XML only (default 0).\n"
+        "The model is written to standard output if no output is given.\n";
+}
+
+static unsigned number(const char *arg)
+{
+    char *end;
+    long n = strtol(arg, &end, 10);
+    if (*arg == '\0' || *end != '\0' || n < 0)
+    {
+        cerr << "Invalid number: " << arg << endl;
+        exit(EXIT_FAILURE);
+    }
+    return n;
+}
+
+int main(int argc, char *argv[])
+{
+    options_t options;
+    bool xta = false;
+    unsigned seed = 1;
+    int c;
+
+    while ((c = getopt(argc, argv, "a:c:C:e:f:F:hi:l:L:n:p:q:s:S:t:")) != -1)
+    {
+        switch (c)
+        {
+        case 'a': options.arrays = number(optarg); break;
+        case 'c': options.clocks = number(optarg); break;
+        case 'C': options.channels = number(optarg); break;
+        case 'e': options.edges = number(optarg); break;
+        case 'f':
+            if (strcmp(optarg, "xml") == 0)
+            {
+                xta = false;
+            }
+            else if (strcmp(optarg, "xta") == 0)
+            {
+                xta = true;
+            }
+            else
+            {
+                cerr << "-f expects either 'xml' or 'xta' argument.\n";
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'F': options.functions = number(optarg); break;
+        case 'i': options.ints = number(optarg); break;
+        case 'l': options.locations = number(optarg); break;
+        case 'L': options.charts = number(optarg); break;
+        case 'n': options.size = number(optarg); break;
+        case 'p': options.processes = number(optarg); break;
+        case 'q': options.queries = number(optarg); break;
+        case 's': seed = number(optarg); break;
+        case 'S': options.selects = number(optarg); break;
+        case 't': options.templates = number(optarg); break;
+        case 'h':
+        default:
+            printHelp(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (argc - optind > 1)
+    {
+        printHelp(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    if (options.size == 0 || options.templates == 0 || options.processes == 0)
+    {
+        cerr << "The model needs a template, a process and a positive size.\n";
+        exit(EXIT_FAILURE);
+    }
+
+    Generator generator(options, seed);
+
+    std::ofstream file;
+    if (optind < argc)
+    {
+        file.open(argv[optind]);
+        if (!file)
+        {
+            perror(argv[optind]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    ostream &out = optind < argc ? file : cout;
+
+    if (xta)
+    {
+        generator.writeXTA(out);
+    }
+    else
+    {
+        generator.writeXML(out);
+    }
+    out.flush();
+    if (!out)
+    {
+        cerr << "Failed to write the model.\n";
+        exit(EXIT_FAILURE);
+    }
+    return 0;
+}
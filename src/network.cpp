@@ -0,0 +1,114 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+#include "utap/network.h"
+
+using namespace UTAP;
+using namespace Constants;
+
+const int32_t Network::NONE;
+
+Network::Network(TimedAutomataSystem &system)
+{
+    std::list<instance_t> &processes = system.getProcesses();
+    size_t locations = 0, edges = 0;
+    for (auto& process: processes)
+    {
+        locations += process.templ->states.size();
+        edges += process.templ->edges.size();
+    }
+
+    processInstance.reserve(processes.size());
+    processInitial.reserve(processes.size());
+    processLocations.reserve(processes.size() + 1);
+    processEdges.reserve(processes.size() + 1);
+    locationState.reserve(locations);
+    locationProcess.reserve(locations);
+    locationFlags.reserve(locations);
+    locationInvariant.reserve(locations);
+    edgeEdge.reserve(edges);
+    edgeProcess.reserve(edges);
+    edgeSource.reserve(edges);
+    edgeTarget.reserve(edges);
+    edgeGuard.reserve(edges);
+    edgeSync.reserve(edges);
+    edgeUpdate.reserve(edges);
+    edgeControllable.reserve(edges);
+
+    int32_t p = 0;
+    for (auto& process: processes)
+    {
+        template_t *templ = process.templ;
+        int32_t first = locationState.size();
+
+        processInstance.push_back(&process);
+        processLocations.push_back(first);
+        processEdges.push_back(edgeEdge.size());
+        processInitial.push_back(
+            templ->init == symbol_t()
+            ? NONE
+            : first + static_cast<state_t*>(templ->init.getData())->locNr);
+
+        for (auto& state: templ->states)
+        {
+            type_t type = state.uid.getType();
+            locationState.push_back(&state);
+            locationProcess.push_back(p);
+            locationFlags.push_back(type.is(Constants::URGENT) ? URGENT
+                                    : type.is(Constants::COMMITTED) ? COMMITTED
+                                    : NORMAL);
+            locationInvariant.push_back(addExpression(state.invariant));
+        }
+
+        for (auto& edge: templ->edges)
+        {
+            edgeEdge.push_back(&edge);
+            edgeProcess.push_back(p);
+            edgeSource.push_back(edge.src ? first + edge.src->locNr : NONE);
+            edgeTarget.push_back(edge.dst ? first + edge.dst->locNr : NONE);
+            edgeGuard.push_back(addExpression(edge.guard));
+            edgeSync.push_back(addExpression(edge.sync));
+            edgeUpdate.push_back(addExpression(edge.assign));
+            edgeControllable.push_back(edge.control);
+        }
+        p++;
+    }
+    processLocations.push_back(locationState.size());
+    processEdges.push_back(edgeEdge.size());
+    expressionIds.clear();
+}
+
+int32_t Network::addExpression(expression_t expr)
+{
+    if (expr.empty())
+    {
+        return NONE;
+    }
+    auto i = expressionIds.find(expr);
+    if (i != expressionIds.end())
+    {
+        return i->second;
+    }
+    int32_t id = expressions.size();
+    expressions.push_back(expr);
+    expressionIds[expr] = id;
+    return id;
+}
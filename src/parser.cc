@@ -80,6 +80,7 @@
 
  #include "libparser.h"
  #include "utap/position.h"
+ #include "utap/statistics.h"
  #include <cstring>
 
  using namespace std;
@@ -113,6 +114,9 @@
  static int utap_lex()
  {
    int old;
+   if (ch->isAborted()) {
+	 return 0;
+   }
    if (syntax_token) {
 	 old = syntax_token;
 	 syntax_token = 0;
@@ -128,7 +132,7 @@
 
  #define YYERROR_VERBOSE 1
 
- #define CALL(first,last,call) do { ch->setPosition(first.start, last.end); try { ch->call; } catch (TypeException &te) { ch->handleError(te.what()); } } while (0)
+ #define CALL(first,last,call) do { Statistics::Phase phase(Statistics::BUILDING); ch->setPosition(first.start, last.end); try { ch->call; } catch (TypeException &te) { ch->handleError(te.what()); } } while (0)
 
  #define YY_(msg) utap_msg(msg)
 
@@ -201,7 +205,7 @@
 }
 
 
-#line 205 "parser.tab.c" /* yacc.c:337  */
+#line 208 "parser.tab.c" /* yacc.c:337  */
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -691,7 +695,7 @@ extern int utap_debug;
 
 union YYSTYPE
 {
-#line 302 "parser.yy" /* yacc.c:352  */
+#line 305 "parser.yy" /* yacc.c:352  */
 
     bool flag;
     int number;
@@ -700,7 +704,7 @@ union YYSTYPE
     char string[MAXLEN];
     double floating;
 
-#line 704 "parser.tab.c" /* yacc.c:352  */
+#line 707 "parser.tab.c" /* yacc.c:352  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -5118,3472 +5122,3472 @@ yyreduce:
   switch (yyn)
     {
         case 2:
-#line 318 "parser.yy" /* yacc.c:1652  */
+#line 321 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), done()); }
-#line 5124 "parser.tab.c" /* yacc.c:1652  */
+#line 5127 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 3:
-#line 319 "parser.yy" /* yacc.c:1652  */
+#line 322 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5130 "parser.tab.c" /* yacc.c:1652  */
+#line 5133 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 4:
-#line 320 "parser.yy" /* yacc.c:1652  */
+#line 323 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5136 "parser.tab.c" /* yacc.c:1652  */
+#line 5139 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 5:
-#line 321 "parser.yy" /* yacc.c:1652  */
+#line 324 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5142 "parser.tab.c" /* yacc.c:1652  */
+#line 5145 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 6:
-#line 322 "parser.yy" /* yacc.c:1652  */
+#line 325 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5148 "parser.tab.c" /* yacc.c:1652  */
+#line 5151 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 7:
-#line 323 "parser.yy" /* yacc.c:1652  */
+#line 326 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5154 "parser.tab.c" /* yacc.c:1652  */
+#line 5157 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 8:
-#line 324 "parser.yy" /* yacc.c:1652  */
+#line 327 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5160 "parser.tab.c" /* yacc.c:1652  */
+#line 5163 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 9:
-#line 325 "parser.yy" /* yacc.c:1652  */
+#line 328 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5166 "parser.tab.c" /* yacc.c:1652  */
+#line 5169 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 10:
-#line 326 "parser.yy" /* yacc.c:1652  */
+#line 329 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procGuard()); }
-#line 5172 "parser.tab.c" /* yacc.c:1652  */
+#line 5175 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 11:
-#line 327 "parser.yy" /* yacc.c:1652  */
+#line 330 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5178 "parser.tab.c" /* yacc.c:1652  */
+#line 5181 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 12:
-#line 328 "parser.yy" /* yacc.c:1652  */
+#line 331 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procUpdate()); }
-#line 5184 "parser.tab.c" /* yacc.c:1652  */
+#line 5187 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 13:
-#line 329 "parser.yy" /* yacc.c:1652  */
+#line 332 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procProb()); }
-#line 5190 "parser.tab.c" /* yacc.c:1652  */
+#line 5193 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 14:
-#line 330 "parser.yy" /* yacc.c:1652  */
+#line 333 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), done()); }
-#line 5196 "parser.tab.c" /* yacc.c:1652  */
+#line 5199 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 15:
-#line 331 "parser.yy" /* yacc.c:1652  */
+#line 334 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5202 "parser.tab.c" /* yacc.c:1652  */
+#line 5205 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 16:
-#line 332 "parser.yy" /* yacc.c:1652  */
+#line 335 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5208 "parser.tab.c" /* yacc.c:1652  */
+#line 5211 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 17:
-#line 333 "parser.yy" /* yacc.c:1652  */
+#line 336 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5214 "parser.tab.c" /* yacc.c:1652  */
+#line 5217 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 18:
-#line 334 "parser.yy" /* yacc.c:1652  */
+#line 337 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5220 "parser.tab.c" /* yacc.c:1652  */
+#line 5223 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 19:
-#line 335 "parser.yy" /* yacc.c:1652  */
+#line 338 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5226 "parser.tab.c" /* yacc.c:1652  */
+#line 5229 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 20:
-#line 336 "parser.yy" /* yacc.c:1652  */
+#line 339 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procGuard()); }
-#line 5232 "parser.tab.c" /* yacc.c:1652  */
+#line 5235 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 21:
-#line 337 "parser.yy" /* yacc.c:1652  */
+#line 340 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procUpdate()); }
-#line 5238 "parser.tab.c" /* yacc.c:1652  */
+#line 5241 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 22:
-#line 338 "parser.yy" /* yacc.c:1652  */
+#line 341 "parser.yy" /* yacc.c:1652  */
     {}
-#line 5244 "parser.tab.c" /* yacc.c:1652  */
+#line 5247 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 23:
-#line 339 "parser.yy" /* yacc.c:1652  */
+#line 342 "parser.yy" /* yacc.c:1652  */
     {}
-#line 5250 "parser.tab.c" /* yacc.c:1652  */
+#line 5253 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 24:
-#line 340 "parser.yy" /* yacc.c:1652  */
+#line 343 "parser.yy" /* yacc.c:1652  */
     {}
-#line 5256 "parser.tab.c" /* yacc.c:1652  */
+#line 5259 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 25:
-#line 341 "parser.yy" /* yacc.c:1652  */
+#line 344 "parser.yy" /* yacc.c:1652  */
     {}
-#line 5262 "parser.tab.c" /* yacc.c:1652  */
+#line 5265 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 26:
-#line 342 "parser.yy" /* yacc.c:1652  */
+#line 345 "parser.yy" /* yacc.c:1652  */
     {}
-#line 5268 "parser.tab.c" /* yacc.c:1652  */
+#line 5271 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 27:
-#line 344 "parser.yy" /* yacc.c:1652  */
+#line 347 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5274 "parser.tab.c" /* yacc.c:1652  */
+#line 5277 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 28:
-#line 345 "parser.yy" /* yacc.c:1652  */
+#line 348 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procLscUpdate()); }
-#line 5280 "parser.tab.c" /* yacc.c:1652  */
+#line 5283 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 29:
-#line 346 "parser.yy" /* yacc.c:1652  */
+#line 349 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procCondition()); }
-#line 5286 "parser.tab.c" /* yacc.c:1652  */
+#line 5289 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 30:
-#line 347 "parser.yy" /* yacc.c:1652  */
+#line 350 "parser.yy" /* yacc.c:1652  */
     { }
-#line 5292 "parser.tab.c" /* yacc.c:1652  */
+#line 5295 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 35:
-#line 361 "parser.yy" /* yacc.c:1652  */
+#line 364 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-4]), (yylsp[-1]), instantiationBegin((yyvsp[-4].string), (yyvsp[-3].number), (yyvsp[-1].string)));
         }
-#line 5300 "parser.tab.c" /* yacc.c:1652  */
+#line 5303 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 36:
-#line 363 "parser.yy" /* yacc.c:1652  */
+#line 366 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-8]), (yylsp[0]), instantiationEnd((yyvsp[-8].string), (yyvsp[-7].number), (yyvsp[-5].string), (yyvsp[-2].number)));
         }
-#line 5308 "parser.tab.c" /* yacc.c:1652  */
+#line 5311 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 37:
-#line 368 "parser.yy" /* yacc.c:1652  */
+#line 371 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), instanceName((yyvsp[0].string), false));
         }
-#line 5316 "parser.tab.c" /* yacc.c:1652  */
+#line 5319 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 38:
-#line 371 "parser.yy" /* yacc.c:1652  */
+#line 374 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), instanceNameBegin((yyvsp[-1].string)));
         }
-#line 5324 "parser.tab.c" /* yacc.c:1652  */
+#line 5327 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 39:
-#line 373 "parser.yy" /* yacc.c:1652  */
+#line 376 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-4]), (yylsp[0]), instanceNameEnd((yyvsp[-4].string), (yyvsp[-1].number)));
         }
-#line 5332 "parser.tab.c" /* yacc.c:1652  */
+#line 5335 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 40:
-#line 378 "parser.yy" /* yacc.c:1652  */
+#line 381 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 0; }
-#line 5338 "parser.tab.c" /* yacc.c:1652  */
+#line 5341 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 41:
-#line 379 "parser.yy" /* yacc.c:1652  */
+#line 382 "parser.yy" /* yacc.c:1652  */
     {
         	(yyval.number) = 0;
         }
-#line 5346 "parser.tab.c" /* yacc.c:1652  */
+#line 5349 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 42:
-#line 382 "parser.yy" /* yacc.c:1652  */
+#line 385 "parser.yy" /* yacc.c:1652  */
     {
         	(yyval.number) = (yyvsp[-1].number);
         }
-#line 5354 "parser.tab.c" /* yacc.c:1652  */
+#line 5357 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 46:
-#line 394 "parser.yy" /* yacc.c:1652  */
+#line 397 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), beginChanPriority()); }
-#line 5360 "parser.tab.c" /* yacc.c:1652  */
+#line 5363 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 47:
-#line 395 "parser.yy" /* yacc.c:1652  */
+#line 398 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-2]), (yylsp[0]), addChanPriority(',')); }
-#line 5366 "parser.tab.c" /* yacc.c:1652  */
+#line 5369 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 48:
-#line 396 "parser.yy" /* yacc.c:1652  */
+#line 399 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-2]), (yylsp[0]), addChanPriority('<')); }
-#line 5372 "parser.tab.c" /* yacc.c:1652  */
+#line 5375 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 50:
-#line 402 "parser.yy" /* yacc.c:1652  */
+#line 405 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), defaultChanPriority()); }
-#line 5378 "parser.tab.c" /* yacc.c:1652  */
+#line 5381 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 51:
-#line 406 "parser.yy" /* yacc.c:1652  */
+#line 409 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), exprId((yyvsp[0].string))); }
-#line 5384 "parser.tab.c" /* yacc.c:1652  */
+#line 5387 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 52:
-#line 407 "parser.yy" /* yacc.c:1652  */
+#line 410 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-3]), (yylsp[0]), exprArray()); }
-#line 5390 "parser.tab.c" /* yacc.c:1652  */
+#line 5393 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 53:
-#line 411 "parser.yy" /* yacc.c:1652  */
+#line 414 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-2]), (yylsp[-2]), processListEnd()); }
-#line 5396 "parser.tab.c" /* yacc.c:1652  */
+#line 5399 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 54:
-#line 412 "parser.yy" /* yacc.c:1652  */
+#line 415 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-2]), (yylsp[-2]), processListEnd()); }
-#line 5402 "parser.tab.c" /* yacc.c:1652  */
+#line 5405 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 56:
-#line 418 "parser.yy" /* yacc.c:1652  */
+#line 421 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-6]), (yylsp[0]), declIO((yyvsp[-4].string),(yyvsp[-3].number),(yyvsp[-1].number))); }
-#line 5408 "parser.tab.c" /* yacc.c:1652  */
+#line 5411 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 57:
-#line 422 "parser.yy" /* yacc.c:1652  */
+#line 425 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 1; }
-#line 5414 "parser.tab.c" /* yacc.c:1652  */
+#line 5417 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 58:
-#line 423 "parser.yy" /* yacc.c:1652  */
+#line 426 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = (yyvsp[-2].number) + 1; }
-#line 5420 "parser.tab.c" /* yacc.c:1652  */
+#line 5423 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 59:
-#line 430 "parser.yy" /* yacc.c:1652  */
+#line 433 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprSync(SYNC_CSP));
         }
-#line 5428 "parser.tab.c" /* yacc.c:1652  */
+#line 5431 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 60:
-#line 433 "parser.yy" /* yacc.c:1652  */
+#line 436 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprSync(SYNC_BANG));
         }
-#line 5436 "parser.tab.c" /* yacc.c:1652  */
+#line 5439 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 61:
-#line 436 "parser.yy" /* yacc.c:1652  */
+#line 439 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), exprSync(SYNC_BANG));
         }
-#line 5444 "parser.tab.c" /* yacc.c:1652  */
+#line 5447 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 62:
-#line 439 "parser.yy" /* yacc.c:1652  */
+#line 442 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprSync(SYNC_QUE));
         }
-#line 5452 "parser.tab.c" /* yacc.c:1652  */
+#line 5455 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 63:
-#line 442 "parser.yy" /* yacc.c:1652  */
+#line 445 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), exprSync(SYNC_QUE));
         }
-#line 5460 "parser.tab.c" /* yacc.c:1652  */
+#line 5463 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 64:
-#line 448 "parser.yy" /* yacc.c:1652  */
+#line 451 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), process((yyvsp[0].string))); }
-#line 5466 "parser.tab.c" /* yacc.c:1652  */
+#line 5469 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 65:
-#line 449 "parser.yy" /* yacc.c:1652  */
+#line 452 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), process((yyvsp[0].string))); }
-#line 5472 "parser.tab.c" /* yacc.c:1652  */
+#line 5475 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 66:
-#line 450 "parser.yy" /* yacc.c:1652  */
+#line 453 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), process((yyvsp[0].string))); }
-#line 5478 "parser.tab.c" /* yacc.c:1652  */
+#line 5481 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 67:
-#line 454 "parser.yy" /* yacc.c:1652  */
+#line 457 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), incProcPriority()); }
-#line 5484 "parser.tab.c" /* yacc.c:1652  */
+#line 5487 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 71:
-#line 462 "parser.yy" /* yacc.c:1652  */
+#line 465 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[-1]), declProgress(true));
         }
-#line 5492 "parser.tab.c" /* yacc.c:1652  */
+#line 5495 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 72:
-#line 465 "parser.yy" /* yacc.c:1652  */
+#line 468 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[-1]), declProgress(false));
         }
-#line 5500 "parser.tab.c" /* yacc.c:1652  */
+#line 5503 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 76:
-#line 476 "parser.yy" /* yacc.c:1652  */
+#line 479 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), ganttDeclStart((yyvsp[0].string))); }
-#line 5506 "parser.tab.c" /* yacc.c:1652  */
+#line 5509 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 77:
-#line 477 "parser.yy" /* yacc.c:1652  */
+#line 480 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-5]), (yylsp[-1]), ganttDeclEnd());
 	}
-#line 5513 "parser.tab.c" /* yacc.c:1652  */
+#line 5516 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 80:
-#line 487 "parser.yy" /* yacc.c:1652  */
+#line 490 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), ganttDeclSelect((yyvsp[-2].string)));
         }
-#line 5521 "parser.tab.c" /* yacc.c:1652  */
+#line 5524 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 81:
-#line 490 "parser.yy" /* yacc.c:1652  */
+#line 493 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), ganttDeclSelect((yyvsp[-2].string)));
         }
-#line 5529 "parser.tab.c" /* yacc.c:1652  */
+#line 5532 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 84:
-#line 501 "parser.yy" /* yacc.c:1652  */
+#line 504 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), ganttEntryStart());
 	    CALL((yylsp[-2]), (yylsp[0]), ganttEntryEnd());
         }
-#line 5538 "parser.tab.c" /* yacc.c:1652  */
+#line 5541 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 85:
-#line 505 "parser.yy" /* yacc.c:1652  */
+#line 508 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), ganttEntryStart()); }
-#line 5544 "parser.tab.c" /* yacc.c:1652  */
+#line 5547 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 86:
-#line 506 "parser.yy" /* yacc.c:1652  */
+#line 509 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-7]), (yylsp[-1]), ganttEntryEnd()); }
-#line 5550 "parser.tab.c" /* yacc.c:1652  */
+#line 5553 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 87:
-#line 510 "parser.yy" /* yacc.c:1652  */
+#line 513 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), ganttEntrySelect((yyvsp[-2].string)));
         }
-#line 5558 "parser.tab.c" /* yacc.c:1652  */
+#line 5561 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 88:
-#line 513 "parser.yy" /* yacc.c:1652  */
+#line 516 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), ganttEntrySelect((yyvsp[-2].string)));
         }
-#line 5566 "parser.tab.c" /* yacc.c:1652  */
+#line 5569 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 100:
-#line 533 "parser.yy" /* yacc.c:1652  */
+#line 536 "parser.yy" /* yacc.c:1652  */
     {CALL((yylsp[-2]),(yylsp[0]),declDynamicTemplate((yyvsp[-1].string)));}
-#line 5572 "parser.tab.c" /* yacc.c:1652  */
+#line 5575 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 102:
-#line 535 "parser.yy" /* yacc.c:1652  */
+#line 538 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-1]), (yylsp[-1]), beforeUpdate()); }
-#line 5578 "parser.tab.c" /* yacc.c:1652  */
+#line 5581 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 103:
-#line 537 "parser.yy" /* yacc.c:1652  */
+#line 540 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-1]), (yylsp[-1]), afterUpdate()); }
-#line 5584 "parser.tab.c" /* yacc.c:1652  */
+#line 5587 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 104:
-#line 548 "parser.yy" /* yacc.c:1652  */
+#line 551 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[-2]), declFuncBegin((yyvsp[-2].string)));
         }
-#line 5592 "parser.tab.c" /* yacc.c:1652  */
+#line 5595 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 105:
-#line 550 "parser.yy" /* yacc.c:1652  */
+#line 553 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), declFuncEnd());
         }
-#line 5600 "parser.tab.c" /* yacc.c:1652  */
+#line 5603 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 111:
-#line 563 "parser.yy" /* yacc.c:1652  */
+#line 566 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 1; }
-#line 5606 "parser.tab.c" /* yacc.c:1652  */
+#line 5609 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 112:
-#line 564 "parser.yy" /* yacc.c:1652  */
+#line 567 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = (yyvsp[-2].number)+1; }
-#line 5612 "parser.tab.c" /* yacc.c:1652  */
+#line 5615 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 113:
-#line 568 "parser.yy" /* yacc.c:1652  */
+#line 571 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), declParameter((yyvsp[-1].string), true));
         }
-#line 5620 "parser.tab.c" /* yacc.c:1652  */
+#line 5623 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 114:
-#line 571 "parser.yy" /* yacc.c:1652  */
+#line 574 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), declParameter((yyvsp[-1].string), false));
         }
-#line 5628 "parser.tab.c" /* yacc.c:1652  */
+#line 5631 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 115:
-#line 577 "parser.yy" /* yacc.c:1652  */
+#line 580 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), typePop());
         }
-#line 5636 "parser.tab.c" /* yacc.c:1652  */
+#line 5639 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 118:
-#line 588 "parser.yy" /* yacc.c:1652  */
+#line 591 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), typeDuplicate());
         }
-#line 5644 "parser.tab.c" /* yacc.c:1652  */
+#line 5647 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 119:
-#line 590 "parser.yy" /* yacc.c:1652  */
+#line 593 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[0]), declVar((yyvsp[-3].string), (yyvsp[0].flag)));
         }
-#line 5652 "parser.tab.c" /* yacc.c:1652  */
+#line 5655 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 120:
-#line 596 "parser.yy" /* yacc.c:1652  */
+#line 599 "parser.yy" /* yacc.c:1652  */
     { (yyval.flag) = false; }
-#line 5658 "parser.tab.c" /* yacc.c:1652  */
+#line 5661 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 121:
-#line 597 "parser.yy" /* yacc.c:1652  */
+#line 600 "parser.yy" /* yacc.c:1652  */
     { (yyval.flag) = true; }
-#line 5664 "parser.tab.c" /* yacc.c:1652  */
+#line 5667 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 123:
-#line 602 "parser.yy" /* yacc.c:1652  */
+#line 605 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), declInitialiserList((yyvsp[-1].number)));
         }
-#line 5672 "parser.tab.c" /* yacc.c:1652  */
+#line 5675 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 124:
-#line 608 "parser.yy" /* yacc.c:1652  */
+#line 611 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 1; }
-#line 5678 "parser.tab.c" /* yacc.c:1652  */
+#line 5681 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 125:
-#line 609 "parser.yy" /* yacc.c:1652  */
+#line 612 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = (yyvsp[-2].number)+1; }
-#line 5684 "parser.tab.c" /* yacc.c:1652  */
+#line 5687 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 126:
-#line 613 "parser.yy" /* yacc.c:1652  */
+#line 616 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), declFieldInit((yyvsp[-2].string)));
         }
-#line 5692 "parser.tab.c" /* yacc.c:1652  */
+#line 5695 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 127:
-#line 616 "parser.yy" /* yacc.c:1652  */
+#line 619 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), declFieldInit(""));
         }
-#line 5700 "parser.tab.c" /* yacc.c:1652  */
+#line 5703 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 128:
-#line 622 "parser.yy" /* yacc.c:1652  */
+#line 625 "parser.yy" /* yacc.c:1652  */
     { types = 0; }
-#line 5706 "parser.tab.c" /* yacc.c:1652  */
+#line 5709 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 131:
-#line 626 "parser.yy" /* yacc.c:1652  */
+#line 629 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-3]), (yylsp[-1]), typeArrayOfSize(types)); }
-#line 5712 "parser.tab.c" /* yacc.c:1652  */
+#line 5715 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 132:
-#line 627 "parser.yy" /* yacc.c:1652  */
+#line 630 "parser.yy" /* yacc.c:1652  */
     { types++; }
-#line 5718 "parser.tab.c" /* yacc.c:1652  */
+#line 5721 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 133:
-#line 627 "parser.yy" /* yacc.c:1652  */
+#line 630 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-4]), (yylsp[-2]), typeArrayOfType(types--)); }
-#line 5724 "parser.tab.c" /* yacc.c:1652  */
+#line 5727 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 135:
-#line 632 "parser.yy" /* yacc.c:1652  */
+#line 635 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), typePop());
         }
-#line 5732 "parser.tab.c" /* yacc.c:1652  */
+#line 5735 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 139:
-#line 644 "parser.yy" /* yacc.c:1652  */
+#line 647 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), typeDuplicate());
         }
-#line 5740 "parser.tab.c" /* yacc.c:1652  */
+#line 5743 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 140:
-#line 646 "parser.yy" /* yacc.c:1652  */
+#line 649 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), declTypeDef((yyvsp[-2].string)));
         }
-#line 5748 "parser.tab.c" /* yacc.c:1652  */
+#line 5751 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 141:
-#line 652 "parser.yy" /* yacc.c:1652  */
+#line 655 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), typeName(ParserBuilder::PREFIX_NONE, (yyvsp[0].string)));
         }
-#line 5756 "parser.tab.c" /* yacc.c:1652  */
+#line 5759 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 142:
-#line 655 "parser.yy" /* yacc.c:1652  */
+#line 658 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), typeName((yyvsp[-1].prefix), (yyvsp[0].string)));
         }
-#line 5764 "parser.tab.c" /* yacc.c:1652  */
+#line 5767 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 143:
-#line 658 "parser.yy" /* yacc.c:1652  */
+#line 661 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[0]), typeStruct(ParserBuilder::PREFIX_NONE, (yyvsp[-1].number)));
         }
-#line 5772 "parser.tab.c" /* yacc.c:1652  */
+#line 5775 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 144:
-#line 661 "parser.yy" /* yacc.c:1652  */
+#line 664 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-4]), (yylsp[0]), typeStruct((yyvsp[-4].prefix), (yyvsp[-1].number)));
         }
-#line 5780 "parser.tab.c" /* yacc.c:1652  */
+#line 5783 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 145:
-#line 664 "parser.yy" /* yacc.c:1652  */
+#line 667 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), typeStruct(ParserBuilder::PREFIX_NONE, 0));
         }
-#line 5788 "parser.tab.c" /* yacc.c:1652  */
+#line 5791 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 146:
-#line 667 "parser.yy" /* yacc.c:1652  */
+#line 670 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-4]), (yylsp[0]), typeStruct(ParserBuilder::PREFIX_NONE, 0));
         }
-#line 5796 "parser.tab.c" /* yacc.c:1652  */
+#line 5799 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 147:
-#line 670 "parser.yy" /* yacc.c:1652  */
+#line 673 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), typeBool(ParserBuilder::PREFIX_NONE));
         }
-#line 5804 "parser.tab.c" /* yacc.c:1652  */
+#line 5807 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 148:
-#line 673 "parser.yy" /* yacc.c:1652  */
+#line 676 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), typeBool((yyvsp[-1].prefix)));
         }
-#line 5812 "parser.tab.c" /* yacc.c:1652  */
+#line 5815 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 149:
-#line 676 "parser.yy" /* yacc.c:1652  */
+#line 679 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), typeDouble(ParserBuilder::PREFIX_NONE));
         }
-#line 5820 "parser.tab.c" /* yacc.c:1652  */
+#line 5823 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 150:
-#line 679 "parser.yy" /* yacc.c:1652  */
+#line 682 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), typeDouble((yyvsp[-1].prefix)));
 	}
-#line 5828 "parser.tab.c" /* yacc.c:1652  */
+#line 5831 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 151:
-#line 682 "parser.yy" /* yacc.c:1652  */
+#line 685 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), typeInt(ParserBuilder::PREFIX_NONE));
         }
-#line 5836 "parser.tab.c" /* yacc.c:1652  */
+#line 5839 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 152:
-#line 685 "parser.yy" /* yacc.c:1652  */
+#line 688 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), typeInt((yyvsp[-1].prefix)));
         }
-#line 5844 "parser.tab.c" /* yacc.c:1652  */
+#line 5847 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 153:
-#line 689 "parser.yy" /* yacc.c:1652  */
+#line 692 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-5]), (yylsp[0]), typeBoundedInt(ParserBuilder::PREFIX_NONE));
         }
-#line 5852 "parser.tab.c" /* yacc.c:1652  */
+#line 5855 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 154:
-#line 692 "parser.yy" /* yacc.c:1652  */
+#line 695 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-6]), (yylsp[0]), typeBoundedInt((yyvsp[-6].prefix)));
         }
-#line 5860 "parser.tab.c" /* yacc.c:1652  */
+#line 5863 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 155:
-#line 695 "parser.yy" /* yacc.c:1652  */
+#line 698 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), typeChannel(ParserBuilder::PREFIX_NONE));
         }
-#line 5868 "parser.tab.c" /* yacc.c:1652  */
+#line 5871 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 156:
-#line 698 "parser.yy" /* yacc.c:1652  */
+#line 701 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), typeChannel((yyvsp[-1].prefix)));
         }
-#line 5876 "parser.tab.c" /* yacc.c:1652  */
+#line 5879 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 157:
-#line 701 "parser.yy" /* yacc.c:1652  */
+#line 704 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), typeClock(ParserBuilder::PREFIX_NONE));
         }
-#line 5884 "parser.tab.c" /* yacc.c:1652  */
+#line 5887 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 158:
-#line 704 "parser.yy" /* yacc.c:1652  */
+#line 707 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[-1]), typeClock(ParserBuilder::PREFIX_HYBRID));
 	}
-#line 5892 "parser.tab.c" /* yacc.c:1652  */
+#line 5895 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 159:
-#line 707 "parser.yy" /* yacc.c:1652  */
+#line 710 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), typeVoid());
         }
-#line 5900 "parser.tab.c" /* yacc.c:1652  */
+#line 5903 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 160:
-#line 711 "parser.yy" /* yacc.c:1652  */
+#line 714 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), typeScalar(ParserBuilder::PREFIX_NONE));
         }
-#line 5908 "parser.tab.c" /* yacc.c:1652  */
+#line 5911 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 161:
-#line 714 "parser.yy" /* yacc.c:1652  */
+#line 717 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-4]), (yylsp[0]), typeScalar((yyvsp[-4].prefix)));
         }
-#line 5916 "parser.tab.c" /* yacc.c:1652  */
+#line 5919 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 162:
-#line 720 "parser.yy" /* yacc.c:1652  */
+#line 723 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), (yyvsp[0].string), MAXLEN); }
-#line 5922 "parser.tab.c" /* yacc.c:1652  */
+#line 5925 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 163:
-#line 721 "parser.yy" /* yacc.c:1652  */
+#line 724 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), (yyvsp[0].string), MAXLEN); }
-#line 5928 "parser.tab.c" /* yacc.c:1652  */
+#line 5931 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 164:
-#line 725 "parser.yy" /* yacc.c:1652  */
+#line 728 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), (yyvsp[0].string) , MAXLEN); }
-#line 5934 "parser.tab.c" /* yacc.c:1652  */
+#line 5937 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 165:
-#line 726 "parser.yy" /* yacc.c:1652  */
+#line 729 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "A", MAXLEN); }
-#line 5940 "parser.tab.c" /* yacc.c:1652  */
+#line 5943 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 166:
-#line 727 "parser.yy" /* yacc.c:1652  */
+#line 730 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "U", MAXLEN); }
-#line 5946 "parser.tab.c" /* yacc.c:1652  */
+#line 5949 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 167:
-#line 728 "parser.yy" /* yacc.c:1652  */
+#line 731 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "W", MAXLEN); }
-#line 5952 "parser.tab.c" /* yacc.c:1652  */
+#line 5955 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 168:
-#line 729 "parser.yy" /* yacc.c:1652  */
+#line 732 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "R", MAXLEN); }
-#line 5958 "parser.tab.c" /* yacc.c:1652  */
+#line 5961 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 169:
-#line 730 "parser.yy" /* yacc.c:1652  */
+#line 733 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "E", MAXLEN); }
-#line 5964 "parser.tab.c" /* yacc.c:1652  */
+#line 5967 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 170:
-#line 731 "parser.yy" /* yacc.c:1652  */
+#line 734 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "M", MAXLEN); }
-#line 5970 "parser.tab.c" /* yacc.c:1652  */
+#line 5973 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 171:
-#line 732 "parser.yy" /* yacc.c:1652  */
+#line 735 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "sup", MAXLEN); }
-#line 5976 "parser.tab.c" /* yacc.c:1652  */
+#line 5979 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 172:
-#line 733 "parser.yy" /* yacc.c:1652  */
+#line 736 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "inf", MAXLEN); }
-#line 5982 "parser.tab.c" /* yacc.c:1652  */
+#line 5985 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 173:
-#line 734 "parser.yy" /* yacc.c:1652  */
+#line 737 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "simulation", MAXLEN); }
-#line 5988 "parser.tab.c" /* yacc.c:1652  */
+#line 5991 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 174:
-#line 735 "parser.yy" /* yacc.c:1652  */
+#line 738 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "refinement", MAXLEN); }
-#line 5994 "parser.tab.c" /* yacc.c:1652  */
+#line 5997 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 175:
-#line 736 "parser.yy" /* yacc.c:1652  */
+#line 739 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "consistency", MAXLEN); }
-#line 6000 "parser.tab.c" /* yacc.c:1652  */
+#line 6003 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 176:
-#line 737 "parser.yy" /* yacc.c:1652  */
+#line 740 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "specification", MAXLEN); }
-#line 6006 "parser.tab.c" /* yacc.c:1652  */
+#line 6009 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 177:
-#line 738 "parser.yy" /* yacc.c:1652  */
+#line 741 "parser.yy" /* yacc.c:1652  */
     { strncpy((yyval.string), "implementation", MAXLEN); }
-#line 6012 "parser.tab.c" /* yacc.c:1652  */
+#line 6015 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 178:
-#line 742 "parser.yy" /* yacc.c:1652  */
+#line 745 "parser.yy" /* yacc.c:1652  */
     { (yyval.number)=(yyvsp[0].number); }
-#line 6018 "parser.tab.c" /* yacc.c:1652  */
+#line 6021 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 179:
-#line 743 "parser.yy" /* yacc.c:1652  */
+#line 746 "parser.yy" /* yacc.c:1652  */
     { (yyval.number)=(yyvsp[-1].number)+(yyvsp[0].number); }
-#line 6024 "parser.tab.c" /* yacc.c:1652  */
+#line 6027 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 180:
-#line 747 "parser.yy" /* yacc.c:1652  */
+#line 750 "parser.yy" /* yacc.c:1652  */
     {
           (yyval.number) = (yyvsp[-1].number);
           CALL((yylsp[-2]), (yylsp[0]), typePop());
         }
-#line 6033 "parser.tab.c" /* yacc.c:1652  */
+#line 6036 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 181:
-#line 754 "parser.yy" /* yacc.c:1652  */
+#line 757 "parser.yy" /* yacc.c:1652  */
     { (yyval.number)=1; }
-#line 6039 "parser.tab.c" /* yacc.c:1652  */
+#line 6042 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 182:
-#line 755 "parser.yy" /* yacc.c:1652  */
+#line 758 "parser.yy" /* yacc.c:1652  */
     { (yyval.number)=(yyvsp[-2].number)+1; }
-#line 6045 "parser.tab.c" /* yacc.c:1652  */
+#line 6048 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 183:
-#line 759 "parser.yy" /* yacc.c:1652  */
+#line 762 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), typeDuplicate());
         }
-#line 6053 "parser.tab.c" /* yacc.c:1652  */
+#line 6056 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 184:
-#line 761 "parser.yy" /* yacc.c:1652  */
+#line 764 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), structField((yyvsp[-2].string)));
         }
-#line 6061 "parser.tab.c" /* yacc.c:1652  */
+#line 6064 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 185:
-#line 767 "parser.yy" /* yacc.c:1652  */
+#line 770 "parser.yy" /* yacc.c:1652  */
     { (yyval.prefix) = ParserBuilder::PREFIX_URGENT; }
-#line 6067 "parser.tab.c" /* yacc.c:1652  */
+#line 6070 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 186:
-#line 768 "parser.yy" /* yacc.c:1652  */
+#line 771 "parser.yy" /* yacc.c:1652  */
     { (yyval.prefix) = ParserBuilder::PREFIX_BROADCAST; }
-#line 6073 "parser.tab.c" /* yacc.c:1652  */
+#line 6076 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 187:
-#line 769 "parser.yy" /* yacc.c:1652  */
+#line 772 "parser.yy" /* yacc.c:1652  */
     { (yyval.prefix) = ParserBuilder::PREFIX_URGENT_BROADCAST; }
-#line 6079 "parser.tab.c" /* yacc.c:1652  */
+#line 6082 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 188:
-#line 770 "parser.yy" /* yacc.c:1652  */
+#line 773 "parser.yy" /* yacc.c:1652  */
     { (yyval.prefix) = ParserBuilder::PREFIX_CONST; }
-#line 6085 "parser.tab.c" /* yacc.c:1652  */
+#line 6088 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 189:
-#line 771 "parser.yy" /* yacc.c:1652  */
+#line 774 "parser.yy" /* yacc.c:1652  */
     { (yyval.prefix) = ParserBuilder::PREFIX_SYSTEM_META; }
-#line 6091 "parser.tab.c" /* yacc.c:1652  */
+#line 6094 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 190:
-#line 779 "parser.yy" /* yacc.c:1652  */
+#line 782 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), procBegin((yyvsp[-2].string)));
         }
-#line 6099 "parser.tab.c" /* yacc.c:1652  */
+#line 6102 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 191:
-#line 782 "parser.yy" /* yacc.c:1652  */
+#line 785 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), procEnd());
         }
-#line 6107 "parser.tab.c" /* yacc.c:1652  */
+#line 6110 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 203:
-#line 811 "parser.yy" /* yacc.c:1652  */
+#line 814 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), procState((yyvsp[0].string), false, false)); }
-#line 6113 "parser.tab.c" /* yacc.c:1652  */
+#line 6116 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 204:
-#line 812 "parser.yy" /* yacc.c:1652  */
+#line 815 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-4]), (yylsp[0]), procState((yyvsp[-4].string), false, true));
 	}
-#line 6121 "parser.tab.c" /* yacc.c:1652  */
+#line 6124 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 205:
-#line 815 "parser.yy" /* yacc.c:1652  */
+#line 818 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), procState((yyvsp[-3].string), true, false));
         }
-#line 6129 "parser.tab.c" /* yacc.c:1652  */
+#line 6132 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 206:
-#line 818 "parser.yy" /* yacc.c:1652  */
+#line 821 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-5]), (yylsp[0]), procState((yyvsp[-5].string), true, true));
 	}
-#line 6137 "parser.tab.c" /* yacc.c:1652  */
+#line 6140 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 207:
-#line 821 "parser.yy" /* yacc.c:1652  */
+#line 824 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), procState((yyvsp[-3].string), false, false));
 	}
-#line 6145 "parser.tab.c" /* yacc.c:1652  */
+#line 6148 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 212:
-#line 837 "parser.yy" /* yacc.c:1652  */
+#line 840 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), procBranchpoint((yyvsp[0].string)));
         }
-#line 6153 "parser.tab.c" /* yacc.c:1652  */
+#line 6156 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 213:
-#line 842 "parser.yy" /* yacc.c:1652  */
+#line 845 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), procStateInit((yyvsp[-1].string)));
         }
-#line 6161 "parser.tab.c" /* yacc.c:1652  */
+#line 6164 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 220:
-#line 860 "parser.yy" /* yacc.c:1652  */
+#line 863 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[-1]), procEdgeBegin((yyvsp[-3].string), (yyvsp[-1].string), true));
         }
-#line 6169 "parser.tab.c" /* yacc.c:1652  */
+#line 6172 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 221:
-#line 862 "parser.yy" /* yacc.c:1652  */
+#line 865 "parser.yy" /* yacc.c:1652  */
     {
           strcpy(rootTransId, (yyvsp[-10].string));
           CALL((yylsp[-10]), (yylsp[-2]), procEdgeEnd((yyvsp[-10].string), (yyvsp[-8].string)));
         }
-#line 6178 "parser.tab.c" /* yacc.c:1652  */
+#line 6181 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 222:
-#line 866 "parser.yy" /* yacc.c:1652  */
+#line 869 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[-1]), procEdgeBegin((yyvsp[-3].string), (yyvsp[-1].string), false));
         }
-#line 6186 "parser.tab.c" /* yacc.c:1652  */
+#line 6189 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 223:
-#line 868 "parser.yy" /* yacc.c:1652  */
+#line 871 "parser.yy" /* yacc.c:1652  */
     {
           strcpy(rootTransId, (yyvsp[-10].string));
           CALL((yylsp[-10]), (yylsp[-2]), procEdgeEnd((yyvsp[-10].string), (yyvsp[-8].string)));
         }
-#line 6195 "parser.tab.c" /* yacc.c:1652  */
+#line 6198 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 224:
-#line 875 "parser.yy" /* yacc.c:1652  */
+#line 878 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[-1]), procEdgeBegin(rootTransId, (yyvsp[-1].string), true));
         }
-#line 6203 "parser.tab.c" /* yacc.c:1652  */
+#line 6206 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 225:
-#line 877 "parser.yy" /* yacc.c:1652  */
+#line 880 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-8]), (yylsp[-2]), procEdgeEnd(rootTransId, (yyvsp[-7].string)));
         }
-#line 6211 "parser.tab.c" /* yacc.c:1652  */
+#line 6214 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 226:
-#line 880 "parser.yy" /* yacc.c:1652  */
+#line 883 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[-1]), procEdgeBegin(rootTransId, (yyvsp[-1].string), false));
         }
-#line 6219 "parser.tab.c" /* yacc.c:1652  */
+#line 6222 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 227:
-#line 882 "parser.yy" /* yacc.c:1652  */
+#line 885 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-8]), (yylsp[-2]), procEdgeEnd(rootTransId, (yyvsp[-7].string)));
         }
-#line 6227 "parser.tab.c" /* yacc.c:1652  */
+#line 6230 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 231:
-#line 894 "parser.yy" /* yacc.c:1652  */
+#line 897 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), procSelect((yyvsp[-2].string)));
         }
-#line 6235 "parser.tab.c" /* yacc.c:1652  */
+#line 6238 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 232:
-#line 897 "parser.yy" /* yacc.c:1652  */
+#line 900 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), procSelect((yyvsp[-2].string)));
         }
-#line 6243 "parser.tab.c" /* yacc.c:1652  */
+#line 6246 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 234:
-#line 904 "parser.yy" /* yacc.c:1652  */
+#line 907 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), procGuard());
         }
-#line 6251 "parser.tab.c" /* yacc.c:1652  */
+#line 6254 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 235:
-#line 907 "parser.yy" /* yacc.c:1652  */
+#line 910 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procGuard());
         }
-#line 6259 "parser.tab.c" /* yacc.c:1652  */
+#line 6262 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 240:
-#line 920 "parser.yy" /* yacc.c:1652  */
+#line 923 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), procSync(SYNC_CSP));
         }
-#line 6267 "parser.tab.c" /* yacc.c:1652  */
+#line 6270 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 241:
-#line 923 "parser.yy" /* yacc.c:1652  */
+#line 926 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), procSync(SYNC_BANG));
         }
-#line 6275 "parser.tab.c" /* yacc.c:1652  */
+#line 6278 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 242:
-#line 926 "parser.yy" /* yacc.c:1652  */
+#line 929 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procSync(SYNC_BANG));
         }
-#line 6283 "parser.tab.c" /* yacc.c:1652  */
+#line 6286 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 243:
-#line 929 "parser.yy" /* yacc.c:1652  */
+#line 932 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), procSync(SYNC_QUE));
         }
-#line 6291 "parser.tab.c" /* yacc.c:1652  */
+#line 6294 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 244:
-#line 932 "parser.yy" /* yacc.c:1652  */
+#line 935 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procSync(SYNC_QUE));
         }
-#line 6299 "parser.tab.c" /* yacc.c:1652  */
+#line 6302 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 245:
-#line 938 "parser.yy" /* yacc.c:1652  */
+#line 941 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), procMessage(SYNC_QUE));
         }
-#line 6307 "parser.tab.c" /* yacc.c:1652  */
+#line 6310 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 246:
-#line 941 "parser.yy" /* yacc.c:1652  */
+#line 944 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), procMessage(SYNC_QUE));
         }
-#line 6315 "parser.tab.c" /* yacc.c:1652  */
+#line 6318 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 248:
-#line 948 "parser.yy" /* yacc.c:1652  */
+#line 951 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), procUpdate());
         }
-#line 6323 "parser.tab.c" /* yacc.c:1652  */
+#line 6326 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 251:
-#line 956 "parser.yy" /* yacc.c:1652  */
+#line 959 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), procProb());
         }
-#line 6331 "parser.tab.c" /* yacc.c:1652  */
+#line 6334 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 260:
-#line 979 "parser.yy" /* yacc.c:1652  */
+#line 982 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), procStateCommit((yyvsp[0].string)));
         }
-#line 6339 "parser.tab.c" /* yacc.c:1652  */
+#line 6342 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 261:
-#line 982 "parser.yy" /* yacc.c:1652  */
+#line 985 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), procStateCommit((yyvsp[0].string)));
         }
-#line 6347 "parser.tab.c" /* yacc.c:1652  */
+#line 6350 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 262:
-#line 988 "parser.yy" /* yacc.c:1652  */
+#line 991 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), procStateUrgent((yyvsp[0].string)));
         }
-#line 6355 "parser.tab.c" /* yacc.c:1652  */
+#line 6358 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 263:
-#line 991 "parser.yy" /* yacc.c:1652  */
+#line 994 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), procStateUrgent((yyvsp[0].string)));
         }
-#line 6363 "parser.tab.c" /* yacc.c:1652  */
+#line 6366 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 265:
-#line 998 "parser.yy" /* yacc.c:1652  */
+#line 1001 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]),(yylsp[0]), exprBinary(FRACTION));
 	}
-#line 6371 "parser.tab.c" /* yacc.c:1652  */
+#line 6374 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 266:
-#line 1007 "parser.yy" /* yacc.c:1652  */
+#line 1010 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), blockBegin());
         }
-#line 6379 "parser.tab.c" /* yacc.c:1652  */
+#line 6382 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 267:
-#line 1010 "parser.yy" /* yacc.c:1652  */
+#line 1013 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[-1]), blockEnd());
         }
-#line 6387 "parser.tab.c" /* yacc.c:1652  */
+#line 6390 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 276:
-#line 1031 "parser.yy" /* yacc.c:1652  */
+#line 1034 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-1]), (yylsp[0]), ifBegin()); }
-#line 6393 "parser.tab.c" /* yacc.c:1652  */
+#line 6396 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 277:
-#line 1031 "parser.yy" /* yacc.c:1652  */
+#line 1034 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-2]), (yylsp[-2]), ifCondition()); }
-#line 6399 "parser.tab.c" /* yacc.c:1652  */
+#line 6402 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 278:
-#line 1033 "parser.yy" /* yacc.c:1652  */
+#line 1036 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-2]), (yylsp[0]), ifThen()); }
-#line 6405 "parser.tab.c" /* yacc.c:1652  */
+#line 6408 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 279:
-#line 1035 "parser.yy" /* yacc.c:1652  */
+#line 1038 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), ifEnd(true));
 	}
-#line 6413 "parser.tab.c" /* yacc.c:1652  */
+#line 6416 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 281:
-#line 1041 "parser.yy" /* yacc.c:1652  */
+#line 1044 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), ifThen());
             CALL((yylsp[-1]), (yylsp[0]), ifEnd(false));
 	}
-#line 6422 "parser.tab.c" /* yacc.c:1652  */
+#line 6425 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 282:
-#line 1045 "parser.yy" /* yacc.c:1652  */
+#line 1048 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), ifEnd(true));
 	}
-#line 6430 "parser.tab.c" /* yacc.c:1652  */
+#line 6433 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 284:
-#line 1052 "parser.yy" /* yacc.c:1652  */
+#line 1055 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), emptyStatement());
         }
-#line 6438 "parser.tab.c" /* yacc.c:1652  */
+#line 6441 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 285:
-#line 1055 "parser.yy" /* yacc.c:1652  */
+#line 1058 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprStatement());
         }
-#line 6446 "parser.tab.c" /* yacc.c:1652  */
+#line 6449 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 288:
-#line 1060 "parser.yy" /* yacc.c:1652  */
+#line 1063 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), breakStatement());
           }
-#line 6454 "parser.tab.c" /* yacc.c:1652  */
+#line 6457 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 289:
-#line 1063 "parser.yy" /* yacc.c:1652  */
+#line 1066 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), continueStatement());
         }
-#line 6462 "parser.tab.c" /* yacc.c:1652  */
+#line 6465 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 290:
-#line 1066 "parser.yy" /* yacc.c:1652  */
+#line 1069 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[0]), switchBegin());
         }
-#line 6470 "parser.tab.c" /* yacc.c:1652  */
+#line 6473 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 291:
-#line 1069 "parser.yy" /* yacc.c:1652  */
+#line 1072 "parser.yy" /* yacc.c:1652  */
     {
                CALL((yylsp[-3]), (yylsp[-1]), switchEnd());
           }
-#line 6478 "parser.tab.c" /* yacc.c:1652  */
+#line 6481 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 292:
-#line 1072 "parser.yy" /* yacc.c:1652  */
+#line 1075 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), returnStatement(true));
         }
-#line 6486 "parser.tab.c" /* yacc.c:1652  */
+#line 6489 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 293:
-#line 1075 "parser.yy" /* yacc.c:1652  */
+#line 1078 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), returnStatement(false));
         }
-#line 6494 "parser.tab.c" /* yacc.c:1652  */
+#line 6497 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 294:
-#line 1078 "parser.yy" /* yacc.c:1652  */
+#line 1081 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[-1]), assertStatement());
 	}
-#line 6502 "parser.tab.c" /* yacc.c:1652  */
+#line 6505 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 295:
-#line 1083 "parser.yy" /* yacc.c:1652  */
+#line 1086 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-7]), (yylsp[0]), forBegin());
         }
-#line 6510 "parser.tab.c" /* yacc.c:1652  */
+#line 6513 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 296:
-#line 1086 "parser.yy" /* yacc.c:1652  */
+#line 1089 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[-1]), forEnd());
         }
-#line 6518 "parser.tab.c" /* yacc.c:1652  */
+#line 6521 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 297:
-#line 1089 "parser.yy" /* yacc.c:1652  */
+#line 1092 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-5]), (yylsp[0]), iterationBegin((yyvsp[-3].string)));
         }
-#line 6526 "parser.tab.c" /* yacc.c:1652  */
+#line 6529 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 298:
-#line 1092 "parser.yy" /* yacc.c:1652  */
+#line 1095 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[-1]), iterationEnd((yyvsp[-5].string)));
         }
-#line 6534 "parser.tab.c" /* yacc.c:1652  */
+#line 6537 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 300:
-#line 1098 "parser.yy" /* yacc.c:1652  */
+#line 1101 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), whileBegin());
         }
-#line 6542 "parser.tab.c" /* yacc.c:1652  */
+#line 6545 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 301:
-#line 1101 "parser.yy" /* yacc.c:1652  */
+#line 1104 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[-2]), whileEnd());
 	}
-#line 6550 "parser.tab.c" /* yacc.c:1652  */
+#line 6553 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 303:
-#line 1105 "parser.yy" /* yacc.c:1652  */
+#line 1108 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), doWhileBegin());
 	}
-#line 6558 "parser.tab.c" /* yacc.c:1652  */
+#line 6561 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 304:
-#line 1108 "parser.yy" /* yacc.c:1652  */
+#line 1111 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-6]), (yylsp[-1]), doWhileEnd());
         }
-#line 6566 "parser.tab.c" /* yacc.c:1652  */
+#line 6569 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 307:
-#line 1118 "parser.yy" /* yacc.c:1652  */
+#line 1121 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), caseBegin());
         }
-#line 6574 "parser.tab.c" /* yacc.c:1652  */
+#line 6577 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 308:
-#line 1121 "parser.yy" /* yacc.c:1652  */
+#line 1124 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[-1]), caseEnd());
 	}
-#line 6582 "parser.tab.c" /* yacc.c:1652  */
+#line 6585 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 309:
-#line 1124 "parser.yy" /* yacc.c:1652  */
+#line 1127 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), defaultBegin());
         }
-#line 6590 "parser.tab.c" /* yacc.c:1652  */
+#line 6593 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 310:
-#line 1127 "parser.yy" /* yacc.c:1652  */
+#line 1130 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[-1]), defaultEnd());
         }
-#line 6598 "parser.tab.c" /* yacc.c:1652  */
+#line 6601 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 312:
-#line 1134 "parser.yy" /* yacc.c:1652  */
+#line 1137 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprComma());
         }
-#line 6606 "parser.tab.c" /* yacc.c:1652  */
+#line 6609 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 313:
-#line 1139 "parser.yy" /* yacc.c:1652  */
+#line 1142 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprFalse());
         }
-#line 6614 "parser.tab.c" /* yacc.c:1652  */
+#line 6617 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 314:
-#line 1142 "parser.yy" /* yacc.c:1652  */
+#line 1145 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprTrue());
         }
-#line 6622 "parser.tab.c" /* yacc.c:1652  */
+#line 6625 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 315:
-#line 1145 "parser.yy" /* yacc.c:1652  */
+#line 1148 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprNat((yyvsp[0].number)));
         }
-#line 6630 "parser.tab.c" /* yacc.c:1652  */
+#line 6633 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 316:
-#line 1148 "parser.yy" /* yacc.c:1652  */
+#line 1151 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprDouble((yyvsp[0].floating)));
 	}
-#line 6638 "parser.tab.c" /* yacc.c:1652  */
+#line 6641 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 317:
-#line 1151 "parser.yy" /* yacc.c:1652  */
+#line 1154 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), exprBuiltinFunction1((yyvsp[-3].kind)));
 	}
-#line 6646 "parser.tab.c" /* yacc.c:1652  */
+#line 6649 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 318:
-#line 1154 "parser.yy" /* yacc.c:1652  */
+#line 1157 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-5]), (yylsp[0]), exprBuiltinFunction2((yyvsp[-5].kind)));
 	}
-#line 6654 "parser.tab.c" /* yacc.c:1652  */
+#line 6657 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 319:
-#line 1157 "parser.yy" /* yacc.c:1652  */
+#line 1160 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-7]), (yylsp[0]), exprBuiltinFunction3((yyvsp[-7].kind)));
 	}
-#line 6662 "parser.tab.c" /* yacc.c:1652  */
+#line 6665 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 320:
-#line 1160 "parser.yy" /* yacc.c:1652  */
+#line 1163 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprId((yyvsp[0].string)));
         }
-#line 6670 "parser.tab.c" /* yacc.c:1652  */
+#line 6673 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 321:
-#line 1163 "parser.yy" /* yacc.c:1652  */
+#line 1166 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), exprCallBegin());
         }
-#line 6678 "parser.tab.c" /* yacc.c:1652  */
+#line 6681 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 322:
-#line 1165 "parser.yy" /* yacc.c:1652  */
+#line 1168 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-4]), (yylsp[0]), exprCallEnd((yyvsp[-1].number)));
         }
-#line 6686 "parser.tab.c" /* yacc.c:1652  */
+#line 6689 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 323:
-#line 1168 "parser.yy" /* yacc.c:1652  */
+#line 1171 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), exprCallBegin());
         }
-#line 6694 "parser.tab.c" /* yacc.c:1652  */
+#line 6697 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 324:
-#line 1170 "parser.yy" /* yacc.c:1652  */
+#line 1173 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-4]), (yylsp[0]), exprCallEnd(0));
         }
-#line 6702 "parser.tab.c" /* yacc.c:1652  */
+#line 6705 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 325:
-#line 1173 "parser.yy" /* yacc.c:1652  */
+#line 1176 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), exprArray());
         }
-#line 6710 "parser.tab.c" /* yacc.c:1652  */
+#line 6713 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 326:
-#line 1176 "parser.yy" /* yacc.c:1652  */
+#line 1179 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), exprFalse());
         }
-#line 6718 "parser.tab.c" /* yacc.c:1652  */
+#line 6721 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 328:
-#line 1180 "parser.yy" /* yacc.c:1652  */
+#line 1183 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprFalse());
         }
-#line 6726 "parser.tab.c" /* yacc.c:1652  */
+#line 6729 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 329:
-#line 1183 "parser.yy" /* yacc.c:1652  */
+#line 1186 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprPostIncrement());
         }
-#line 6734 "parser.tab.c" /* yacc.c:1652  */
+#line 6737 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 330:
-#line 1186 "parser.yy" /* yacc.c:1652  */
+#line 1189 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprPreIncrement());
         }
-#line 6742 "parser.tab.c" /* yacc.c:1652  */
+#line 6745 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 331:
-#line 1189 "parser.yy" /* yacc.c:1652  */
+#line 1192 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprPostDecrement());
         }
-#line 6750 "parser.tab.c" /* yacc.c:1652  */
+#line 6753 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 332:
-#line 1192 "parser.yy" /* yacc.c:1652  */
+#line 1195 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprPreDecrement());
         }
-#line 6758 "parser.tab.c" /* yacc.c:1652  */
+#line 6761 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 333:
-#line 1195 "parser.yy" /* yacc.c:1652  */
+#line 1198 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprNat(INT_MIN));
 	}
-#line 6766 "parser.tab.c" /* yacc.c:1652  */
+#line 6769 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 334:
-#line 1198 "parser.yy" /* yacc.c:1652  */
+#line 1201 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[0]), exprUnary((yyvsp[-1].kind)));
         }
-#line 6774 "parser.tab.c" /* yacc.c:1652  */
+#line 6777 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 335:
-#line 1201 "parser.yy" /* yacc.c:1652  */
+#line 1204 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(LT));
         }
-#line 6782 "parser.tab.c" /* yacc.c:1652  */
+#line 6785 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 336:
-#line 1204 "parser.yy" /* yacc.c:1652  */
+#line 1207 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(LE));
         }
-#line 6790 "parser.tab.c" /* yacc.c:1652  */
+#line 6793 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 337:
-#line 1207 "parser.yy" /* yacc.c:1652  */
+#line 1210 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(EQ));
         }
-#line 6798 "parser.tab.c" /* yacc.c:1652  */
+#line 6801 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 338:
-#line 1210 "parser.yy" /* yacc.c:1652  */
+#line 1213 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(NEQ));
         }
-#line 6806 "parser.tab.c" /* yacc.c:1652  */
+#line 6809 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 339:
-#line 1213 "parser.yy" /* yacc.c:1652  */
+#line 1216 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(GT));
         }
-#line 6814 "parser.tab.c" /* yacc.c:1652  */
+#line 6817 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 340:
-#line 1216 "parser.yy" /* yacc.c:1652  */
+#line 1219 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(GE));
         }
-#line 6822 "parser.tab.c" /* yacc.c:1652  */
+#line 6825 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 341:
-#line 1219 "parser.yy" /* yacc.c:1652  */
+#line 1222 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(PLUS));
         }
-#line 6830 "parser.tab.c" /* yacc.c:1652  */
+#line 6833 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 342:
-#line 1222 "parser.yy" /* yacc.c:1652  */
+#line 1225 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(MINUS));
         }
-#line 6838 "parser.tab.c" /* yacc.c:1652  */
+#line 6841 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 343:
-#line 1225 "parser.yy" /* yacc.c:1652  */
+#line 1228 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(MULT));
         }
-#line 6846 "parser.tab.c" /* yacc.c:1652  */
+#line 6849 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 344:
-#line 1228 "parser.yy" /* yacc.c:1652  */
+#line 1231 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(DIV));
         }
-#line 6854 "parser.tab.c" /* yacc.c:1652  */
+#line 6857 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 345:
-#line 1231 "parser.yy" /* yacc.c:1652  */
+#line 1234 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(MOD));
         }
-#line 6862 "parser.tab.c" /* yacc.c:1652  */
+#line 6865 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 346:
-#line 1234 "parser.yy" /* yacc.c:1652  */
+#line 1237 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(BIT_AND));
         }
-#line 6870 "parser.tab.c" /* yacc.c:1652  */
+#line 6873 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 347:
-#line 1237 "parser.yy" /* yacc.c:1652  */
+#line 1240 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(BIT_OR));
         }
-#line 6878 "parser.tab.c" /* yacc.c:1652  */
+#line 6881 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 348:
-#line 1240 "parser.yy" /* yacc.c:1652  */
+#line 1243 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(BIT_XOR));
         }
-#line 6886 "parser.tab.c" /* yacc.c:1652  */
+#line 6889 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 349:
-#line 1243 "parser.yy" /* yacc.c:1652  */
+#line 1246 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(BIT_LSHIFT));
         }
-#line 6894 "parser.tab.c" /* yacc.c:1652  */
+#line 6897 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 350:
-#line 1246 "parser.yy" /* yacc.c:1652  */
+#line 1249 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(BIT_RSHIFT));
         }
-#line 6902 "parser.tab.c" /* yacc.c:1652  */
+#line 6905 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 351:
-#line 1249 "parser.yy" /* yacc.c:1652  */
+#line 1252 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(AND));
         }
-#line 6910 "parser.tab.c" /* yacc.c:1652  */
+#line 6913 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 352:
-#line 1252 "parser.yy" /* yacc.c:1652  */
+#line 1255 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(OR));
         }
-#line 6918 "parser.tab.c" /* yacc.c:1652  */
+#line 6921 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 353:
-#line 1255 "parser.yy" /* yacc.c:1652  */
+#line 1258 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-4]), (yylsp[0]), exprInlineIf());
         }
-#line 6926 "parser.tab.c" /* yacc.c:1652  */
+#line 6929 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 354:
-#line 1258 "parser.yy" /* yacc.c:1652  */
+#line 1261 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprDot((yyvsp[0].string)));
         }
-#line 6934 "parser.tab.c" /* yacc.c:1652  */
+#line 6937 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 355:
-#line 1261 "parser.yy" /* yacc.c:1652  */
+#line 1264 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), exprUnary(RATE));
         }
-#line 6942 "parser.tab.c" /* yacc.c:1652  */
+#line 6945 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 356:
-#line 1264 "parser.yy" /* yacc.c:1652  */
+#line 1267 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), exprDeadlock());
         }
-#line 6950 "parser.tab.c" /* yacc.c:1652  */
+#line 6953 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 357:
-#line 1267 "parser.yy" /* yacc.c:1652  */
+#line 1270 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), exprUnary(NOT));
         }
-#line 6958 "parser.tab.c" /* yacc.c:1652  */
+#line 6961 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 358:
-#line 1269 "parser.yy" /* yacc.c:1652  */
+#line 1272 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), exprBinary(OR));
         }
-#line 6966 "parser.tab.c" /* yacc.c:1652  */
+#line 6969 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 359:
-#line 1272 "parser.yy" /* yacc.c:1652  */
+#line 1275 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(AND));
         }
-#line 6974 "parser.tab.c" /* yacc.c:1652  */
+#line 6977 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 360:
-#line 1275 "parser.yy" /* yacc.c:1652  */
+#line 1278 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(OR));
         }
-#line 6982 "parser.tab.c" /* yacc.c:1652  */
+#line 6985 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 361:
-#line 1278 "parser.yy" /* yacc.c:1652  */
+#line 1281 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprBinary(XOR));
 	}
-#line 6990 "parser.tab.c" /* yacc.c:1652  */
+#line 6993 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 362:
-#line 1281 "parser.yy" /* yacc.c:1652  */
+#line 1284 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), exprBinary(MIN));
         }
-#line 6998 "parser.tab.c" /* yacc.c:1652  */
+#line 7001 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 363:
-#line 1284 "parser.yy" /* yacc.c:1652  */
+#line 1287 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[0]), exprBinary(MAX));
         }
-#line 7006 "parser.tab.c" /* yacc.c:1652  */
+#line 7009 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 364:
-#line 1287 "parser.yy" /* yacc.c:1652  */
+#line 1290 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-5]), (yylsp[0]), exprSumBegin((yyvsp[-3].string)));
         }
-#line 7014 "parser.tab.c" /* yacc.c:1652  */
+#line 7017 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 365:
-#line 1289 "parser.yy" /* yacc.c:1652  */
+#line 1292 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-7]), (yylsp[0]), exprSumEnd((yyvsp[-5].string)));
         }
-#line 7022 "parser.tab.c" /* yacc.c:1652  */
+#line 7025 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 366:
-#line 1292 "parser.yy" /* yacc.c:1652  */
+#line 1295 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-5]), (yylsp[0]), exprForAllBegin((yyvsp[-3].string)));
         }
-#line 7030 "parser.tab.c" /* yacc.c:1652  */
+#line 7033 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 367:
-#line 1294 "parser.yy" /* yacc.c:1652  */
+#line 1297 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-7]), (yylsp[0]), exprForAllEnd((yyvsp[-5].string)));
         }
-#line 7038 "parser.tab.c" /* yacc.c:1652  */
+#line 7041 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 368:
-#line 1297 "parser.yy" /* yacc.c:1652  */
+#line 1300 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-5]), (yylsp[0]), exprExistsBegin((yyvsp[-3].string)));
         }
-#line 7046 "parser.tab.c" /* yacc.c:1652  */
+#line 7049 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 369:
-#line 1299 "parser.yy" /* yacc.c:1652  */
+#line 1302 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-7]), (yylsp[0]), exprExistsEnd((yyvsp[-5].string)));
         }
-#line 7054 "parser.tab.c" /* yacc.c:1652  */
+#line 7057 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 373:
-#line 1308 "parser.yy" /* yacc.c:1652  */
+#line 1311 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]),(yylsp[0]), exprId((yyvsp[0].string)));
 	}
-#line 7062 "parser.tab.c" /* yacc.c:1652  */
+#line 7065 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 374:
-#line 1310 "parser.yy" /* yacc.c:1652  */
+#line 1313 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-5]),(yylsp[0]), exprSpawn((yyvsp[-1].number)));
 	}
-#line 7070 "parser.tab.c" /* yacc.c:1652  */
+#line 7073 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 375:
-#line 1313 "parser.yy" /* yacc.c:1652  */
+#line 1316 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]),(yylsp[0]), exprExit());
 	}
-#line 7078 "parser.tab.c" /* yacc.c:1652  */
+#line 7081 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 376:
-#line 1316 "parser.yy" /* yacc.c:1652  */
+#line 1319 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]),(yylsp[-1]), exprId((yyvsp[-1].string)));
 	    CALL((yylsp[-3]),(yylsp[0]), exprNumOf());
 	}
-#line 7087 "parser.tab.c" /* yacc.c:1652  */
+#line 7090 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 377:
-#line 1320 "parser.yy" /* yacc.c:1652  */
+#line 1323 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-4]),(yylsp[0]), exprId((yyvsp[0].string)));
 	    CALL((yylsp[-4]),(yylsp[0]), exprForAllDynamicBegin((yyvsp[-2].string),(yyvsp[0].string)));
 	}
-#line 7096 "parser.tab.c" /* yacc.c:1652  */
+#line 7099 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 378:
-#line 1323 "parser.yy" /* yacc.c:1652  */
+#line 1326 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-9]),(yylsp[-2]), exprForAllDynamicEnd((yyvsp[-7].string)));
 	}
-#line 7104 "parser.tab.c" /* yacc.c:1652  */
+#line 7107 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 379:
-#line 1326 "parser.yy" /* yacc.c:1652  */
+#line 1329 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-4]),(yylsp[0]), exprId((yyvsp[0].string)));
 	    CALL((yylsp[-4]),(yylsp[0]), exprExistsDynamicBegin((yyvsp[-2].string),(yyvsp[0].string)));
 	}
-#line 7113 "parser.tab.c" /* yacc.c:1652  */
+#line 7116 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 380:
-#line 1329 "parser.yy" /* yacc.c:1652  */
+#line 1332 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-9]),(yylsp[-2]), exprExistsDynamicEnd((yyvsp[-7].string)));
 	}
-#line 7121 "parser.tab.c" /* yacc.c:1652  */
+#line 7124 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 381:
-#line 1332 "parser.yy" /* yacc.c:1652  */
+#line 1335 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-4]),(yylsp[0]), exprId((yyvsp[0].string)));
 	    CALL((yylsp[-4]),(yylsp[0]), exprSumDynamicBegin((yyvsp[-2].string),(yyvsp[0].string)));
 	}
-#line 7130 "parser.tab.c" /* yacc.c:1652  */
+#line 7133 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 382:
-#line 1335 "parser.yy" /* yacc.c:1652  */
+#line 1338 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-7]),(yylsp[0]), exprSumDynamicEnd((yyvsp[-5].string)));
 	}
-#line 7138 "parser.tab.c" /* yacc.c:1652  */
+#line 7141 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 383:
-#line 1338 "parser.yy" /* yacc.c:1652  */
+#line 1341 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-4]),(yylsp[0]), exprId((yyvsp[0].string)));
 	    CALL((yylsp[-4]),(yylsp[0]), exprForeachDynamicBegin((yyvsp[-2].string),(yyvsp[0].string)));
 	}
-#line 7147 "parser.tab.c" /* yacc.c:1652  */
+#line 7150 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 384:
-#line 1341 "parser.yy" /* yacc.c:1652  */
+#line 1344 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-7]),(yylsp[0]), exprForeachDynamicEnd((yyvsp[-5].string)));
 	}
-#line 7155 "parser.tab.c" /* yacc.c:1652  */
+#line 7158 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 385:
-#line 1348 "parser.yy" /* yacc.c:1652  */
+#line 1351 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprAssignment((yyvsp[-1].kind)));
         }
-#line 7163 "parser.tab.c" /* yacc.c:1652  */
+#line 7166 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 386:
-#line 1354 "parser.yy" /* yacc.c:1652  */
+#line 1357 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSIGN; }
-#line 7169 "parser.tab.c" /* yacc.c:1652  */
+#line 7172 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 387:
-#line 1355 "parser.yy" /* yacc.c:1652  */
+#line 1358 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSPLUS; }
-#line 7175 "parser.tab.c" /* yacc.c:1652  */
+#line 7178 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 388:
-#line 1356 "parser.yy" /* yacc.c:1652  */
+#line 1359 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSMINUS; }
-#line 7181 "parser.tab.c" /* yacc.c:1652  */
+#line 7184 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 389:
-#line 1357 "parser.yy" /* yacc.c:1652  */
+#line 1360 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSDIV; }
-#line 7187 "parser.tab.c" /* yacc.c:1652  */
+#line 7190 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 390:
-#line 1358 "parser.yy" /* yacc.c:1652  */
+#line 1361 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSMOD; }
-#line 7193 "parser.tab.c" /* yacc.c:1652  */
+#line 7196 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 391:
-#line 1359 "parser.yy" /* yacc.c:1652  */
+#line 1362 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSMULT; }
-#line 7199 "parser.tab.c" /* yacc.c:1652  */
+#line 7202 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 392:
-#line 1360 "parser.yy" /* yacc.c:1652  */
+#line 1363 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSAND; }
-#line 7205 "parser.tab.c" /* yacc.c:1652  */
+#line 7208 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 393:
-#line 1361 "parser.yy" /* yacc.c:1652  */
+#line 1364 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSOR; }
-#line 7211 "parser.tab.c" /* yacc.c:1652  */
+#line 7214 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 394:
-#line 1362 "parser.yy" /* yacc.c:1652  */
+#line 1365 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSXOR; }
-#line 7217 "parser.tab.c" /* yacc.c:1652  */
+#line 7220 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 395:
-#line 1363 "parser.yy" /* yacc.c:1652  */
+#line 1366 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSLSHIFT; }
-#line 7223 "parser.tab.c" /* yacc.c:1652  */
+#line 7226 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 396:
-#line 1364 "parser.yy" /* yacc.c:1652  */
+#line 1367 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASSRSHIFT; }
-#line 7229 "parser.tab.c" /* yacc.c:1652  */
+#line 7232 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 397:
-#line 1369 "parser.yy" /* yacc.c:1652  */
+#line 1372 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = MINUS; }
-#line 7235 "parser.tab.c" /* yacc.c:1652  */
+#line 7238 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 398:
-#line 1370 "parser.yy" /* yacc.c:1652  */
+#line 1373 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = PLUS; }
-#line 7241 "parser.tab.c" /* yacc.c:1652  */
+#line 7244 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 399:
-#line 1371 "parser.yy" /* yacc.c:1652  */
+#line 1374 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = NOT; }
-#line 7247 "parser.tab.c" /* yacc.c:1652  */
+#line 7250 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 400:
-#line 1372 "parser.yy" /* yacc.c:1652  */
+#line 1375 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = NOT; }
-#line 7253 "parser.tab.c" /* yacc.c:1652  */
+#line 7256 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 401:
-#line 1376 "parser.yy" /* yacc.c:1652  */
+#line 1379 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ABS_F; }
-#line 7259 "parser.tab.c" /* yacc.c:1652  */
+#line 7262 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 402:
-#line 1377 "parser.yy" /* yacc.c:1652  */
+#line 1380 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FABS_F; }
-#line 7265 "parser.tab.c" /* yacc.c:1652  */
+#line 7268 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 403:
-#line 1378 "parser.yy" /* yacc.c:1652  */
+#line 1381 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = EXP_F; }
-#line 7271 "parser.tab.c" /* yacc.c:1652  */
+#line 7274 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 404:
-#line 1379 "parser.yy" /* yacc.c:1652  */
+#line 1382 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = EXP2_F; }
-#line 7277 "parser.tab.c" /* yacc.c:1652  */
+#line 7280 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 405:
-#line 1380 "parser.yy" /* yacc.c:1652  */
+#line 1383 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = EXPM1_F; }
-#line 7283 "parser.tab.c" /* yacc.c:1652  */
+#line 7286 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 406:
-#line 1381 "parser.yy" /* yacc.c:1652  */
+#line 1384 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LN_F; }
-#line 7289 "parser.tab.c" /* yacc.c:1652  */
+#line 7292 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 407:
-#line 1382 "parser.yy" /* yacc.c:1652  */
+#line 1385 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LOG_F; }
-#line 7295 "parser.tab.c" /* yacc.c:1652  */
+#line 7298 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 408:
-#line 1383 "parser.yy" /* yacc.c:1652  */
+#line 1386 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LOG10_F; }
-#line 7301 "parser.tab.c" /* yacc.c:1652  */
+#line 7304 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 409:
-#line 1384 "parser.yy" /* yacc.c:1652  */
+#line 1387 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LOG2_F; }
-#line 7307 "parser.tab.c" /* yacc.c:1652  */
+#line 7310 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 410:
-#line 1385 "parser.yy" /* yacc.c:1652  */
+#line 1388 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LOG1P_F; }
-#line 7313 "parser.tab.c" /* yacc.c:1652  */
+#line 7316 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 411:
-#line 1386 "parser.yy" /* yacc.c:1652  */
+#line 1389 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = SQRT_F; }
-#line 7319 "parser.tab.c" /* yacc.c:1652  */
+#line 7322 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 412:
-#line 1387 "parser.yy" /* yacc.c:1652  */
+#line 1390 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = CBRT_F; }
-#line 7325 "parser.tab.c" /* yacc.c:1652  */
+#line 7328 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 413:
-#line 1388 "parser.yy" /* yacc.c:1652  */
+#line 1391 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = SIN_F; }
-#line 7331 "parser.tab.c" /* yacc.c:1652  */
+#line 7334 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 414:
-#line 1389 "parser.yy" /* yacc.c:1652  */
+#line 1392 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = COS_F; }
-#line 7337 "parser.tab.c" /* yacc.c:1652  */
+#line 7340 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 415:
-#line 1390 "parser.yy" /* yacc.c:1652  */
+#line 1393 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = TAN_F; }
-#line 7343 "parser.tab.c" /* yacc.c:1652  */
+#line 7346 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 416:
-#line 1391 "parser.yy" /* yacc.c:1652  */
+#line 1394 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASIN_F; }
-#line 7349 "parser.tab.c" /* yacc.c:1652  */
+#line 7352 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 417:
-#line 1392 "parser.yy" /* yacc.c:1652  */
+#line 1395 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ACOS_F; }
-#line 7355 "parser.tab.c" /* yacc.c:1652  */
+#line 7358 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 418:
-#line 1393 "parser.yy" /* yacc.c:1652  */
+#line 1396 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ATAN_F; }
-#line 7361 "parser.tab.c" /* yacc.c:1652  */
+#line 7364 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 419:
-#line 1394 "parser.yy" /* yacc.c:1652  */
+#line 1397 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = SINH_F; }
-#line 7367 "parser.tab.c" /* yacc.c:1652  */
+#line 7370 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 420:
-#line 1395 "parser.yy" /* yacc.c:1652  */
+#line 1398 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = COSH_F; }
-#line 7373 "parser.tab.c" /* yacc.c:1652  */
+#line 7376 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 421:
-#line 1396 "parser.yy" /* yacc.c:1652  */
+#line 1399 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = TANH_F; }
-#line 7379 "parser.tab.c" /* yacc.c:1652  */
+#line 7382 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 422:
-#line 1397 "parser.yy" /* yacc.c:1652  */
+#line 1400 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ASINH_F; }
-#line 7385 "parser.tab.c" /* yacc.c:1652  */
+#line 7388 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 423:
-#line 1398 "parser.yy" /* yacc.c:1652  */
+#line 1401 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ACOSH_F; }
-#line 7391 "parser.tab.c" /* yacc.c:1652  */
+#line 7394 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 424:
-#line 1399 "parser.yy" /* yacc.c:1652  */
+#line 1402 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ATANH_F; }
-#line 7397 "parser.tab.c" /* yacc.c:1652  */
+#line 7400 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 425:
-#line 1400 "parser.yy" /* yacc.c:1652  */
+#line 1403 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ERF_F; }
-#line 7403 "parser.tab.c" /* yacc.c:1652  */
+#line 7406 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 426:
-#line 1401 "parser.yy" /* yacc.c:1652  */
+#line 1404 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ERFC_F; }
-#line 7409 "parser.tab.c" /* yacc.c:1652  */
+#line 7412 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 427:
-#line 1402 "parser.yy" /* yacc.c:1652  */
+#line 1405 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = TGAMMA_F; }
-#line 7415 "parser.tab.c" /* yacc.c:1652  */
+#line 7418 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 428:
-#line 1403 "parser.yy" /* yacc.c:1652  */
+#line 1406 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LGAMMA_F; }
-#line 7421 "parser.tab.c" /* yacc.c:1652  */
+#line 7424 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 429:
-#line 1404 "parser.yy" /* yacc.c:1652  */
+#line 1407 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = CEIL_F; }
-#line 7427 "parser.tab.c" /* yacc.c:1652  */
+#line 7430 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 430:
-#line 1405 "parser.yy" /* yacc.c:1652  */
+#line 1408 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FLOOR_F; }
-#line 7433 "parser.tab.c" /* yacc.c:1652  */
+#line 7436 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 431:
-#line 1406 "parser.yy" /* yacc.c:1652  */
+#line 1409 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = TRUNC_F; }
-#line 7439 "parser.tab.c" /* yacc.c:1652  */
+#line 7442 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 432:
-#line 1407 "parser.yy" /* yacc.c:1652  */
+#line 1410 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ROUND_F; }
-#line 7445 "parser.tab.c" /* yacc.c:1652  */
+#line 7448 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 433:
-#line 1408 "parser.yy" /* yacc.c:1652  */
+#line 1411 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FINT_F; }
-#line 7451 "parser.tab.c" /* yacc.c:1652  */
+#line 7454 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 434:
-#line 1409 "parser.yy" /* yacc.c:1652  */
+#line 1412 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ILOGB_F; }
-#line 7457 "parser.tab.c" /* yacc.c:1652  */
+#line 7460 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 435:
-#line 1410 "parser.yy" /* yacc.c:1652  */
+#line 1413 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LOGB_F; }
-#line 7463 "parser.tab.c" /* yacc.c:1652  */
+#line 7466 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 436:
-#line 1411 "parser.yy" /* yacc.c:1652  */
+#line 1414 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FPCLASSIFY_F; }
-#line 7469 "parser.tab.c" /* yacc.c:1652  */
+#line 7472 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 437:
-#line 1412 "parser.yy" /* yacc.c:1652  */
+#line 1415 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ISFINITE_F; }
-#line 7475 "parser.tab.c" /* yacc.c:1652  */
+#line 7478 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 438:
-#line 1413 "parser.yy" /* yacc.c:1652  */
+#line 1416 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ISINF_F; }
-#line 7481 "parser.tab.c" /* yacc.c:1652  */
+#line 7484 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 439:
-#line 1414 "parser.yy" /* yacc.c:1652  */
+#line 1417 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ISNAN_F; }
-#line 7487 "parser.tab.c" /* yacc.c:1652  */
+#line 7490 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 440:
-#line 1415 "parser.yy" /* yacc.c:1652  */
+#line 1418 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ISNORMAL_F; }
-#line 7493 "parser.tab.c" /* yacc.c:1652  */
+#line 7496 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 441:
-#line 1416 "parser.yy" /* yacc.c:1652  */
+#line 1419 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = SIGNBIT_F; }
-#line 7499 "parser.tab.c" /* yacc.c:1652  */
+#line 7502 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 442:
-#line 1417 "parser.yy" /* yacc.c:1652  */
+#line 1420 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ISUNORDERED_F; }
-#line 7505 "parser.tab.c" /* yacc.c:1652  */
+#line 7508 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 443:
-#line 1418 "parser.yy" /* yacc.c:1652  */
+#line 1421 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_F; }
-#line 7511 "parser.tab.c" /* yacc.c:1652  */
+#line 7514 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 444:
-#line 1419 "parser.yy" /* yacc.c:1652  */
+#line 1422 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_POISSON_F; }
-#line 7517 "parser.tab.c" /* yacc.c:1652  */
+#line 7520 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 445:
-#line 1423 "parser.yy" /* yacc.c:1652  */
+#line 1426 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FMOD_F; }
-#line 7523 "parser.tab.c" /* yacc.c:1652  */
+#line 7526 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 446:
-#line 1424 "parser.yy" /* yacc.c:1652  */
+#line 1427 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FMAX_F; }
-#line 7529 "parser.tab.c" /* yacc.c:1652  */
+#line 7532 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 447:
-#line 1425 "parser.yy" /* yacc.c:1652  */
+#line 1428 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FMIN_F; }
-#line 7535 "parser.tab.c" /* yacc.c:1652  */
+#line 7538 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 448:
-#line 1426 "parser.yy" /* yacc.c:1652  */
+#line 1429 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FDIM_F; }
-#line 7541 "parser.tab.c" /* yacc.c:1652  */
+#line 7544 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 449:
-#line 1427 "parser.yy" /* yacc.c:1652  */
+#line 1430 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = POW_F; }
-#line 7547 "parser.tab.c" /* yacc.c:1652  */
+#line 7550 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 450:
-#line 1428 "parser.yy" /* yacc.c:1652  */
+#line 1431 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = HYPOT_F; }
-#line 7553 "parser.tab.c" /* yacc.c:1652  */
+#line 7556 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 451:
-#line 1429 "parser.yy" /* yacc.c:1652  */
+#line 1432 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = ATAN2_F; }
-#line 7559 "parser.tab.c" /* yacc.c:1652  */
+#line 7562 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 452:
-#line 1430 "parser.yy" /* yacc.c:1652  */
+#line 1433 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LDEXP_F; }
-#line 7565 "parser.tab.c" /* yacc.c:1652  */
+#line 7568 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 453:
-#line 1431 "parser.yy" /* yacc.c:1652  */
+#line 1434 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = NEXTAFTER_F; }
-#line 7571 "parser.tab.c" /* yacc.c:1652  */
+#line 7574 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 454:
-#line 1432 "parser.yy" /* yacc.c:1652  */
+#line 1435 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = COPYSIGN_F; }
-#line 7577 "parser.tab.c" /* yacc.c:1652  */
+#line 7580 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 455:
-#line 1433 "parser.yy" /* yacc.c:1652  */
+#line 1436 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_ARCSINE_F; }
-#line 7583 "parser.tab.c" /* yacc.c:1652  */
+#line 7586 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 456:
-#line 1434 "parser.yy" /* yacc.c:1652  */
+#line 1437 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_BETA_F;    }
-#line 7589 "parser.tab.c" /* yacc.c:1652  */
+#line 7592 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 457:
-#line 1435 "parser.yy" /* yacc.c:1652  */
+#line 1438 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_GAMMA_F;   }
-#line 7595 "parser.tab.c" /* yacc.c:1652  */
+#line 7598 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 458:
-#line 1436 "parser.yy" /* yacc.c:1652  */
+#line 1439 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_NORMAL_F;  }
-#line 7601 "parser.tab.c" /* yacc.c:1652  */
+#line 7604 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 459:
-#line 1437 "parser.yy" /* yacc.c:1652  */
+#line 1440 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_WEIBULL_F; }
-#line 7607 "parser.tab.c" /* yacc.c:1652  */
+#line 7610 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 460:
-#line 1441 "parser.yy" /* yacc.c:1652  */
+#line 1444 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = FMA_F; }
-#line 7613 "parser.tab.c" /* yacc.c:1652  */
+#line 7616 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 461:
-#line 1442 "parser.yy" /* yacc.c:1652  */
+#line 1445 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = RANDOM_TRI_F; }
-#line 7619 "parser.tab.c" /* yacc.c:1652  */
+#line 7622 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 462:
-#line 1447 "parser.yy" /* yacc.c:1652  */
+#line 1450 "parser.yy" /* yacc.c:1652  */
     { (yyval.number)=0; }
-#line 7625 "parser.tab.c" /* yacc.c:1652  */
+#line 7628 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 463:
-#line 1448 "parser.yy" /* yacc.c:1652  */
+#line 1451 "parser.yy" /* yacc.c:1652  */
     {
             (yyval.number) = 1;
         }
-#line 7633 "parser.tab.c" /* yacc.c:1652  */
+#line 7636 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 464:
-#line 1451 "parser.yy" /* yacc.c:1652  */
+#line 1454 "parser.yy" /* yacc.c:1652  */
     {
             (yyval.number) = (yyvsp[-2].number) + 1;
         }
-#line 7641 "parser.tab.c" /* yacc.c:1652  */
+#line 7644 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 470:
-#line 1472 "parser.yy" /* yacc.c:1652  */
+#line 1475 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), typeInt(ParserBuilder::PREFIX_CONST));
         }
-#line 7649 "parser.tab.c" /* yacc.c:1652  */
+#line 7652 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 471:
-#line 1474 "parser.yy" /* yacc.c:1652  */
+#line 1477 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[-1]), typePop());
         }
-#line 7657 "parser.tab.c" /* yacc.c:1652  */
+#line 7660 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 475:
-#line 1485 "parser.yy" /* yacc.c:1652  */
+#line 1488 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), typeDuplicate());
         }
-#line 7665 "parser.tab.c" /* yacc.c:1652  */
+#line 7668 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 476:
-#line 1487 "parser.yy" /* yacc.c:1652  */
+#line 1490 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), declVar((yyvsp[-3].string), true));
         }
-#line 7673 "parser.tab.c" /* yacc.c:1652  */
+#line 7676 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 477:
-#line 1496 "parser.yy" /* yacc.c:1652  */
+#line 1499 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), procBegin((yyvsp[-2].string)));
         }
-#line 7681 "parser.tab.c" /* yacc.c:1652  */
+#line 7684 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 478:
-#line 1499 "parser.yy" /* yacc.c:1652  */
+#line 1502 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procEnd());
         }
-#line 7689 "parser.tab.c" /* yacc.c:1652  */
+#line 7692 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 479:
-#line 1502 "parser.yy" /* yacc.c:1652  */
+#line 1505 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-4]), (yylsp[0]), procBegin((yyvsp[-3].string)));
         }
-#line 7697 "parser.tab.c" /* yacc.c:1652  */
+#line 7700 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 480:
-#line 1505 "parser.yy" /* yacc.c:1652  */
+#line 1508 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procEnd());
         }
-#line 7705 "parser.tab.c" /* yacc.c:1652  */
+#line 7708 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 481:
-#line 1508 "parser.yy" /* yacc.c:1652  */
+#line 1511 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-3]), (yylsp[0]), procBegin((yyvsp[-2].string)));
         }
-#line 7713 "parser.tab.c" /* yacc.c:1652  */
+#line 7716 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 482:
-#line 1511 "parser.yy" /* yacc.c:1652  */
+#line 1514 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procEnd());
         }
-#line 7721 "parser.tab.c" /* yacc.c:1652  */
+#line 7724 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 483:
-#line 1514 "parser.yy" /* yacc.c:1652  */
+#line 1517 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), procBegin("_"));
         }
-#line 7729 "parser.tab.c" /* yacc.c:1652  */
+#line 7732 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 484:
-#line 1517 "parser.yy" /* yacc.c:1652  */
+#line 1520 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procEnd());
         }
-#line 7737 "parser.tab.c" /* yacc.c:1652  */
+#line 7740 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 485:
-#line 1520 "parser.yy" /* yacc.c:1652  */
+#line 1523 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), procBegin((yyvsp[-1].string)));
         }
-#line 7745 "parser.tab.c" /* yacc.c:1652  */
+#line 7748 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 486:
-#line 1523 "parser.yy" /* yacc.c:1652  */
+#line 1526 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procEnd());
         }
-#line 7753 "parser.tab.c" /* yacc.c:1652  */
+#line 7756 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 490:
-#line 1535 "parser.yy" /* yacc.c:1652  */
+#line 1538 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[0]), (yylsp[0]), typePop());
         }
-#line 7761 "parser.tab.c" /* yacc.c:1652  */
+#line 7764 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 492:
-#line 1539 "parser.yy" /* yacc.c:1652  */
+#line 1542 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), typePop());
         }
-#line 7769 "parser.tab.c" /* yacc.c:1652  */
+#line 7772 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 494:
-#line 1546 "parser.yy" /* yacc.c:1652  */
+#line 1549 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), typeDuplicate());
         }
-#line 7777 "parser.tab.c" /* yacc.c:1652  */
+#line 7780 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 495:
-#line 1548 "parser.yy" /* yacc.c:1652  */
+#line 1551 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[0]), declParameter((yyvsp[-1].string), true));
         }
-#line 7785 "parser.tab.c" /* yacc.c:1652  */
+#line 7788 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 496:
-#line 1551 "parser.yy" /* yacc.c:1652  */
+#line 1554 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), typeDuplicate());
         }
-#line 7793 "parser.tab.c" /* yacc.c:1652  */
+#line 7796 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 497:
-#line 1553 "parser.yy" /* yacc.c:1652  */
+#line 1556 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-4]), (yylsp[0]), declParameter((yyvsp[-1].string), true));
         }
-#line 7801 "parser.tab.c" /* yacc.c:1652  */
+#line 7804 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 498:
-#line 1559 "parser.yy" /* yacc.c:1652  */
+#line 1562 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), typeInt(ParserBuilder::PREFIX_CONST));
         }
-#line 7809 "parser.tab.c" /* yacc.c:1652  */
+#line 7812 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 499:
-#line 1561 "parser.yy" /* yacc.c:1652  */
+#line 1564 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), declParameter((yyvsp[-1].string), false));
         }
-#line 7817 "parser.tab.c" /* yacc.c:1652  */
+#line 7820 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 500:
-#line 1564 "parser.yy" /* yacc.c:1652  */
+#line 1567 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[-1]), typeInt(ParserBuilder::PREFIX_CONST));
         }
-#line 7825 "parser.tab.c" /* yacc.c:1652  */
+#line 7828 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 501:
-#line 1566 "parser.yy" /* yacc.c:1652  */
+#line 1569 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-1]), (yylsp[0]), declParameter((yyvsp[-1].string), false));
         }
-#line 7833 "parser.tab.c" /* yacc.c:1652  */
+#line 7836 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 509:
-#line 1591 "parser.yy" /* yacc.c:1652  */
+#line 1594 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), procState((yyvsp[0].string), false, false));
         }
-#line 7841 "parser.tab.c" /* yacc.c:1652  */
+#line 7844 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 510:
-#line 1594 "parser.yy" /* yacc.c:1652  */
+#line 1597 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), procState((yyvsp[-3].string), true, false));
         }
-#line 7849 "parser.tab.c" /* yacc.c:1652  */
+#line 7852 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 512:
-#line 1601 "parser.yy" /* yacc.c:1652  */
+#line 1604 "parser.yy" /* yacc.c:1652  */
     {
         }
-#line 7856 "parser.tab.c" /* yacc.c:1652  */
+#line 7859 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 513:
-#line 1603 "parser.yy" /* yacc.c:1652  */
+#line 1606 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(AND));
         }
-#line 7864 "parser.tab.c" /* yacc.c:1652  */
+#line 7867 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 519:
-#line 1620 "parser.yy" /* yacc.c:1652  */
+#line 1623 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-3]), (yylsp[-1]), procEdgeBegin((yyvsp[-3].string), (yyvsp[-1].string), true));
         }
-#line 7872 "parser.tab.c" /* yacc.c:1652  */
+#line 7875 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 520:
-#line 1622 "parser.yy" /* yacc.c:1652  */
+#line 1625 "parser.yy" /* yacc.c:1652  */
     {
             strcpy(rootTransId, (yyvsp[-8].string));
             CALL((yylsp[-8]), (yylsp[-1]), procEdgeEnd((yyvsp[-8].string), (yyvsp[-6].string)));
         }
-#line 7881 "parser.tab.c" /* yacc.c:1652  */
+#line 7884 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 521:
-#line 1630 "parser.yy" /* yacc.c:1652  */
+#line 1633 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[-1]), procEdgeBegin(rootTransId, (yyvsp[-1].string), true));
         }
-#line 7889 "parser.tab.c" /* yacc.c:1652  */
+#line 7892 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 522:
-#line 1632 "parser.yy" /* yacc.c:1652  */
+#line 1635 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-7]), (yylsp[-1]), procEdgeEnd(rootTransId, (yyvsp[-6].string)));
         }
-#line 7897 "parser.tab.c" /* yacc.c:1652  */
+#line 7900 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 525:
-#line 1640 "parser.yy" /* yacc.c:1652  */
+#line 1643 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-1]), (yylsp[-1]), procGuard());
         }
-#line 7905 "parser.tab.c" /* yacc.c:1652  */
+#line 7908 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 526:
-#line 1643 "parser.yy" /* yacc.c:1652  */
+#line 1646 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[-1]), procGuard());
         }
-#line 7913 "parser.tab.c" /* yacc.c:1652  */
+#line 7916 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 528:
-#line 1650 "parser.yy" /* yacc.c:1652  */
+#line 1653 "parser.yy" /* yacc.c:1652  */
     {
           CALL((yylsp[-2]), (yylsp[0]), exprBinary(AND));
         }
-#line 7921 "parser.tab.c" /* yacc.c:1652  */
+#line 7924 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 538:
-#line 1677 "parser.yy" /* yacc.c:1652  */
+#line 1680 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprUnary(AF));
 	}
-#line 7929 "parser.tab.c" /* yacc.c:1652  */
+#line 7932 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 539:
-#line 1680 "parser.yy" /* yacc.c:1652  */
+#line 1683 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[-2]), (yylsp[-1]), exprUnary(AF));
             CALL((yylsp[-4]), (yylsp[-1]), exprBinary(AND));
             CALL((yylsp[-6]), (yylsp[0]), exprUnary(AG));
         }
-#line 7939 "parser.tab.c" /* yacc.c:1652  */
+#line 7942 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 540:
-#line 1685 "parser.yy" /* yacc.c:1652  */
+#line 1688 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprUnary(AG));
         }
-#line 7947 "parser.tab.c" /* yacc.c:1652  */
+#line 7950 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 541:
-#line 1688 "parser.yy" /* yacc.c:1652  */
+#line 1691 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprUnary(EF));
         }
-#line 7955 "parser.tab.c" /* yacc.c:1652  */
+#line 7958 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 542:
-#line 1691 "parser.yy" /* yacc.c:1652  */
+#line 1694 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprUnary(EG));
         }
-#line 7963 "parser.tab.c" /* yacc.c:1652  */
+#line 7966 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 543:
-#line 1694 "parser.yy" /* yacc.c:1652  */
+#line 1697 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprBinary(LEADSTO));
         }
-#line 7971 "parser.tab.c" /* yacc.c:1652  */
+#line 7974 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 544:
-#line 1697 "parser.yy" /* yacc.c:1652  */
+#line 1700 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-5]), (yylsp[0]), exprBinary(A_UNTIL));
         }
-#line 7979 "parser.tab.c" /* yacc.c:1652  */
+#line 7982 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 545:
-#line 1700 "parser.yy" /* yacc.c:1652  */
+#line 1703 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-5]), (yylsp[0]), exprBinary(A_WEAKUNTIL));
         }
-#line 7987 "parser.tab.c" /* yacc.c:1652  */
+#line 7990 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 546:
-#line 1706 "parser.yy" /* yacc.c:1652  */
+#line 1709 "parser.yy" /* yacc.c:1652  */
     {
         CALL((yylsp[0]), (yylsp[0]), property());
 	}
-#line 7995 "parser.tab.c" /* yacc.c:1652  */
+#line 7998 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 547:
-#line 1709 "parser.yy" /* yacc.c:1652  */
+#line 1712 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprUnary(AG_R_Piotr));
             CALL((yylsp[-1]), (yylsp[0]), property());
     }
-#line 8004 "parser.tab.c" /* yacc.c:1652  */
+#line 8007 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 548:
-#line 1713 "parser.yy" /* yacc.c:1652  */
+#line 1716 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprUnary(EF_R_Piotr));
         CALL((yylsp[-1]), (yylsp[0]), property());
     }
-#line 8013 "parser.tab.c" /* yacc.c:1652  */
+#line 8016 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 549:
-#line 1717 "parser.yy" /* yacc.c:1652  */
+#line 1720 "parser.yy" /* yacc.c:1652  */
     {
         // Deprecated, comes from old uppaal-prob.
 	    CALL((yylsp[-1]), (yylsp[0]), exprUnary(PMAX));
         CALL((yylsp[-1]), (yylsp[0]), property());
 	}
-#line 8023 "parser.tab.c" /* yacc.c:1652  */
+#line 8026 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 550:
-#line 1722 "parser.yy" /* yacc.c:1652  */
+#line 1725 "parser.yy" /* yacc.c:1652  */
     {
         CALL((yylsp[-2]), (yylsp[0]), exprUnary(CONTROL));
         CALL((yylsp[-2]), (yylsp[0]), property());
     }
-#line 8032 "parser.tab.c" /* yacc.c:1652  */
+#line 8035 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 551:
-#line 1726 "parser.yy" /* yacc.c:1652  */
+#line 1729 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-5]), (yylsp[0]), exprSMCControl());
 	    CALL((yylsp[-5]), (yylsp[0]), property());
 	}
-#line 8041 "parser.tab.c" /* yacc.c:1652  */
+#line 8044 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 552:
-#line 1730 "parser.yy" /* yacc.c:1652  */
+#line 1733 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-8]), (yylsp[0]), exprTernary(CONTROL_TOPT));
 	    CALL((yylsp[-8]), (yylsp[0]), property());
 	}
-#line 8050 "parser.tab.c" /* yacc.c:1652  */
+#line 8053 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 553:
-#line 1734 "parser.yy" /* yacc.c:1652  */
+#line 1737 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-6]), (yylsp[0]), exprBinary(CONTROL_TOPT_DEF1));
 	    CALL((yylsp[-6]), (yylsp[0]), property());
 	}
-#line 8059 "parser.tab.c" /* yacc.c:1652  */
+#line 8062 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 554:
-#line 1738 "parser.yy" /* yacc.c:1652  */
+#line 1741 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), exprUnary(CONTROL_TOPT_DEF2));
 	    CALL((yylsp[-3]), (yylsp[0]), property());
 	}
-#line 8068 "parser.tab.c" /* yacc.c:1652  */
+#line 8071 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 555:
-#line 1742 "parser.yy" /* yacc.c:1652  */
+#line 1745 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), exprUnary(EF_CONTROL));
 	    CALL((yylsp[-3]), (yylsp[0]), property());
 	}
-#line 8077 "parser.tab.c" /* yacc.c:1652  */
+#line 8080 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 556:
-#line 1746 "parser.yy" /* yacc.c:1652  */
+#line 1749 "parser.yy" /* yacc.c:1652  */
     {
         CALL((yylsp[-3]), (yylsp[0]), exprBinary(PO_CONTROL));
 	    CALL((yylsp[-3]), (yylsp[0]), property());
     }
-#line 8086 "parser.tab.c" /* yacc.c:1652  */
+#line 8089 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 557:
-#line 1750 "parser.yy" /* yacc.c:1652  */
+#line 1753 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), exprBinary(SIMULATION_LE));
 	    CALL((yylsp[-5]), (yylsp[0]), property());
 	}
-#line 8095 "parser.tab.c" /* yacc.c:1652  */
+#line 8098 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 558:
-#line 1754 "parser.yy" /* yacc.c:1652  */
+#line 1757 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), exprBinary(SIMULATION_GE));
 	    CALL((yylsp[-5]), (yylsp[0]), property());
 	}
-#line 8104 "parser.tab.c" /* yacc.c:1652  */
+#line 8107 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 559:
-#line 1758 "parser.yy" /* yacc.c:1652  */
+#line 1761 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprBinary(REFINEMENT_LE));
 	    CALL((yylsp[-4]), (yylsp[0]), property());
 	}
-#line 8113 "parser.tab.c" /* yacc.c:1652  */
+#line 8116 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 560:
-#line 1762 "parser.yy" /* yacc.c:1652  */
+#line 1765 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprBinary(REFINEMENT_GE));
 	    CALL((yylsp[-4]), (yylsp[0]), property());
 	}
-#line 8122 "parser.tab.c" /* yacc.c:1652  */
+#line 8125 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 561:
-#line 1766 "parser.yy" /* yacc.c:1652  */
+#line 1769 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), property());
 	}
-#line 8130 "parser.tab.c" /* yacc.c:1652  */
+#line 8133 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 562:
-#line 1769 "parser.yy" /* yacc.c:1652  */
+#line 1772 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprUnary(SPECIFICATION));
 	    CALL((yylsp[-2]), (yylsp[0]), property());
 	}
-#line 8139 "parser.tab.c" /* yacc.c:1652  */
+#line 8142 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 563:
-#line 1773 "parser.yy" /* yacc.c:1652  */
+#line 1776 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprUnary(IMPLEMENTATION));
 	    CALL((yylsp[-2]), (yylsp[0]), property());
 	}
-#line 8148 "parser.tab.c" /* yacc.c:1652  */
+#line 8151 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 564:
-#line 1777 "parser.yy" /* yacc.c:1652  */
+#line 1780 "parser.yy" /* yacc.c:1652  */
     {
         CALL((yylsp[-2]), (yylsp[0]), scenario((yyvsp[0].string))); //check if all instances in the scenario
                                         //correspond to TA processes in the system
         CALL((yylsp[-2]), (yylsp[0]), exprScenario((yyvsp[0].string)));
         CALL((yylsp[-2]), (yylsp[0]), property());
     }
-#line 8159 "parser.tab.c" /* yacc.c:1652  */
+#line 8162 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 565:
-#line 1783 "parser.yy" /* yacc.c:1652  */
+#line 1786 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-7]), (yylsp[0]), exprProbaQualitative((yyvsp[-4].kind), (yyvsp[-1].kind), (yyvsp[0].floating)));
 	    CALL((yylsp[-7]), (yylsp[0]), property());
 	}
-#line 8168 "parser.tab.c" /* yacc.c:1652  */
+#line 8171 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 566:
-#line 1787 "parser.yy" /* yacc.c:1652  */
+#line 1790 "parser.yy" /* yacc.c:1652  */
     {
         CALL((yylsp[0]), (yylsp[0]), exprTrue()); // push a trivial stop-predicate (see next rule)
         CALL((yylsp[-5]), (yylsp[0]), exprProbaQuantitative((yyvsp[-2].kind)));
 	    CALL((yylsp[-5]), (yylsp[0]), property());
 	}
-#line 8178 "parser.tab.c" /* yacc.c:1652  */
+#line 8181 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 567:
-#line 1792 "parser.yy" /* yacc.c:1652  */
+#line 1795 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-6]), (yylsp[0]), exprProbaQuantitative(DIAMOND));
 	    CALL((yylsp[-6]), (yylsp[0]), property());
     }
-#line 8187 "parser.tab.c" /* yacc.c:1652  */
+#line 8190 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 568:
-#line 1797 "parser.yy" /* yacc.c:1652  */
+#line 1800 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-12]), (yylsp[0]), exprProbaCompare((yyvsp[-9].kind), (yyvsp[-2].kind)));
 	    CALL((yylsp[-12]), (yylsp[0]), property());
 	}
-#line 8196 "parser.tab.c" /* yacc.c:1652  */
+#line 8199 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 569:
-#line 1801 "parser.yy" /* yacc.c:1652  */
+#line 1804 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-4]), (yylsp[0]), exprSimulate((yyvsp[-1].number)));
 	    CALL((yylsp[-4]), (yylsp[0]), property());
 	}
-#line 8205 "parser.tab.c" /* yacc.c:1652  */
+#line 8208 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 570:
-#line 1805 "parser.yy" /* yacc.c:1652  */
+#line 1808 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-6]), (yylsp[0]), exprSimulate((yyvsp[-3].number), true));
 	    CALL((yylsp[-6]), (yylsp[0]), property());
 	}
-#line 8214 "parser.tab.c" /* yacc.c:1652  */
+#line 8217 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 571:
-#line 1809 "parser.yy" /* yacc.c:1652  */
+#line 1812 "parser.yy" /* yacc.c:1652  */
     {
         CALL((yylsp[-8]), (yylsp[0]), exprSimulate((yyvsp[-5].number), true, (yyvsp[-2].number)));
 	    CALL((yylsp[-8]), (yylsp[0]), property());
 	}
-#line 8223 "parser.tab.c" /* yacc.c:1652  */
+#line 8226 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 572:
-#line 1813 "parser.yy" /* yacc.c:1652  */
+#line 1816 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-6]), (yylsp[0]), exprProbaExpected((yyvsp[-3].string)));
 	    CALL((yylsp[-6]), (yylsp[0]), property());
     }
-#line 8232 "parser.tab.c" /* yacc.c:1652  */
+#line 8235 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 573:
-#line 1817 "parser.yy" /* yacc.c:1652  */
+#line 1820 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]),(yylsp[0]), exprMitlFormula());
 	    CALL((yylsp[-1]),(yylsp[0]), property());
     }
-#line 8241 "parser.tab.c" /* yacc.c:1652  */
+#line 8244 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 574:
-#line 1824 "parser.yy" /* yacc.c:1652  */
+#line 1827 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-9]),(yylsp[0]), exprMitlUntil((yyvsp[-5].number),(yyvsp[-3].number)));
         }
-#line 8249 "parser.tab.c" /* yacc.c:1652  */
+#line 8252 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 575:
-#line 1827 "parser.yy" /* yacc.c:1652  */
+#line 1830 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-9]),(yylsp[0]), exprMitlRelease((yyvsp[-5].number),(yyvsp[-3].number)));
         }
-#line 8257 "parser.tab.c" /* yacc.c:1652  */
+#line 8260 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 576:
-#line 1830 "parser.yy" /* yacc.c:1652  */
+#line 1833 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]),(yylsp[0]), exprMitlNext());
         }
-#line 8265 "parser.tab.c" /* yacc.c:1652  */
+#line 8268 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 577:
-#line 1833 "parser.yy" /* yacc.c:1652  */
+#line 1836 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-8]),(yylsp[-5]), exprMitlDiamond((yyvsp[-5].number),(yyvsp[-3].number)));
         }
-#line 8273 "parser.tab.c" /* yacc.c:1652  */
+#line 8276 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 578:
-#line 1836 "parser.yy" /* yacc.c:1652  */
+#line 1839 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-8]),(yylsp[-5]), exprMitlBox((yyvsp[-5].number),(yyvsp[-3].number)));
         }
-#line 8281 "parser.tab.c" /* yacc.c:1652  */
+#line 8284 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 579:
-#line 1842 "parser.yy" /* yacc.c:1652  */
+#line 1845 "parser.yy" /* yacc.c:1652  */
     {
 			CALL((yylsp[-2]), (yylsp[-2]), exprNat(-1));
 		}
-#line 8289 "parser.tab.c" /* yacc.c:1652  */
+#line 8292 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 580:
-#line 1845 "parser.yy" /* yacc.c:1652  */
+#line 1848 "parser.yy" /* yacc.c:1652  */
     {
 			CALL((yylsp[-4]), (yylsp[-2]), exprNat((yyvsp[-1].number)));
 		}
-#line 8297 "parser.tab.c" /* yacc.c:1652  */
+#line 8300 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 581:
-#line 1850 "parser.yy" /* yacc.c:1652  */
+#line 1853 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[-1]), (yylsp[0]), exprNat(0)); }
-#line 8303 "parser.tab.c" /* yacc.c:1652  */
+#line 8306 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 583:
-#line 1851 "parser.yy" /* yacc.c:1652  */
+#line 1854 "parser.yy" /* yacc.c:1652  */
     { CALL((yylsp[0]), (yylsp[0]), exprNat(1)); }
-#line 8309 "parser.tab.c" /* yacc.c:1652  */
+#line 8312 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 586:
-#line 1856 "parser.yy" /* yacc.c:1652  */
+#line 1859 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = GE; }
-#line 8315 "parser.tab.c" /* yacc.c:1652  */
+#line 8318 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 587:
-#line 1857 "parser.yy" /* yacc.c:1652  */
+#line 1860 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = LE; }
-#line 8321 "parser.tab.c" /* yacc.c:1652  */
+#line 8324 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 588:
-#line 1861 "parser.yy" /* yacc.c:1652  */
+#line 1864 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = BOX; }
-#line 8327 "parser.tab.c" /* yacc.c:1652  */
+#line 8330 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 589:
-#line 1862 "parser.yy" /* yacc.c:1652  */
+#line 1865 "parser.yy" /* yacc.c:1652  */
     { (yyval.kind) = DIAMOND; }
-#line 8333 "parser.tab.c" /* yacc.c:1652  */
+#line 8336 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 590:
-#line 1866 "parser.yy" /* yacc.c:1652  */
+#line 1869 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprTrue());
 	    CALL((yylsp[0]), (yylsp[0]), exprUnary(AG));
             CALL((yylsp[0]), (yylsp[0]), exprBinary(CONSISTENCY));
 	}
-#line 8343 "parser.tab.c" /* yacc.c:1652  */
+#line 8346 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 591:
-#line 1871 "parser.yy" /* yacc.c:1652  */
+#line 1874 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[-1]), exprBinary(CONSISTENCY));
 	}
-#line 8351 "parser.tab.c" /* yacc.c:1652  */
+#line 8354 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 592:
-#line 1874 "parser.yy" /* yacc.c:1652  */
+#line 1877 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[-2]), exprBinary(CONSISTENCY));
         }
-#line 8359 "parser.tab.c" /* yacc.c:1652  */
+#line 8362 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 593:
-#line 1877 "parser.yy" /* yacc.c:1652  */
+#line 1880 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[-1]), exprBinary(CONSISTENCY));
 	}
-#line 8367 "parser.tab.c" /* yacc.c:1652  */
+#line 8370 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 594:
-#line 1880 "parser.yy" /* yacc.c:1652  */
+#line 1883 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[-1]), exprBinary(CONSISTENCY));
 	}
-#line 8375 "parser.tab.c" /* yacc.c:1652  */
+#line 8378 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 595:
-#line 1883 "parser.yy" /* yacc.c:1652  */
+#line 1886 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[-1]), exprBinary(CONSISTENCY));
 	}
-#line 8383 "parser.tab.c" /* yacc.c:1652  */
+#line 8386 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 596:
-#line 1889 "parser.yy" /* yacc.c:1652  */
+#line 1892 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), exprId((yyvsp[0].string)));
 	}
-#line 8391 "parser.tab.c" /* yacc.c:1652  */
+#line 8394 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 597:
-#line 1895 "parser.yy" /* yacc.c:1652  */
+#line 1898 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprNary(SYNTAX_COMPOSITION, (yyvsp[0].number)));
 	}
-#line 8399 "parser.tab.c" /* yacc.c:1652  */
+#line 8402 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 598:
-#line 1901 "parser.yy" /* yacc.c:1652  */
+#line 1904 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprNary(TIOCOMPOSITION, (yyvsp[0].number)));
 	}
-#line 8407 "parser.tab.c" /* yacc.c:1652  */
+#line 8410 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 599:
-#line 1907 "parser.yy" /* yacc.c:1652  */
+#line 1910 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprNary(TIOCONJUNCTION, (yyvsp[0].number)));
 	}
-#line 8415 "parser.tab.c" /* yacc.c:1652  */
+#line 8418 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 600:
-#line 1913 "parser.yy" /* yacc.c:1652  */
+#line 1916 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprBinary(TIOQUOTIENT));
 	}
-#line 8423 "parser.tab.c" /* yacc.c:1652  */
+#line 8426 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 601:
-#line 1919 "parser.yy" /* yacc.c:1652  */
+#line 1922 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 2; }
-#line 8429 "parser.tab.c" /* yacc.c:1652  */
+#line 8432 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 602:
-#line 1920 "parser.yy" /* yacc.c:1652  */
+#line 1923 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = (yyvsp[-2].number) + 1; }
-#line 8435 "parser.tab.c" /* yacc.c:1652  */
+#line 8438 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 603:
-#line 1924 "parser.yy" /* yacc.c:1652  */
+#line 1927 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 2; }
-#line 8441 "parser.tab.c" /* yacc.c:1652  */
+#line 8444 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 604:
-#line 1925 "parser.yy" /* yacc.c:1652  */
+#line 1928 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = (yyvsp[-2].number) + 1; }
-#line 8447 "parser.tab.c" /* yacc.c:1652  */
+#line 8450 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 605:
-#line 1929 "parser.yy" /* yacc.c:1652  */
+#line 1932 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 2; }
-#line 8453 "parser.tab.c" /* yacc.c:1652  */
+#line 8456 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 606:
-#line 1930 "parser.yy" /* yacc.c:1652  */
+#line 1933 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = (yyvsp[-2].number) + 1; }
-#line 8459 "parser.tab.c" /* yacc.c:1652  */
+#line 8462 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 607:
-#line 1934 "parser.yy" /* yacc.c:1652  */
+#line 1937 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), exprTrue());
 	    CALL((yylsp[0]), (yylsp[0]), exprUnary(AG));
         }
-#line 8468 "parser.tab.c" /* yacc.c:1652  */
+#line 8471 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 609:
-#line 1943 "parser.yy" /* yacc.c:1652  */
+#line 1946 "parser.yy" /* yacc.c:1652  */
     {
             CALL((yylsp[0]), (yylsp[0]), exprNary(LIST,0));
 	    CALL((yylsp[0]), (yylsp[0]), exprBinary(RESTRICT));
         }
-#line 8477 "parser.tab.c" /* yacc.c:1652  */
+#line 8480 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 610:
-#line 1947 "parser.yy" /* yacc.c:1652  */
+#line 1950 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-3]), (yylsp[0]), exprNary(LIST,(yyvsp[-1].number)));
 	    CALL((yylsp[-3]), (yylsp[0]), exprBinary(RESTRICT));
 	}
-#line 8486 "parser.tab.c" /* yacc.c:1652  */
+#line 8489 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 611:
-#line 1954 "parser.yy" /* yacc.c:1652  */
+#line 1957 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprId((yyvsp[0].string)));
 	    CALL((yylsp[0]), (yylsp[0]), exprNary(LIST,1));
 	}
-#line 8495 "parser.tab.c" /* yacc.c:1652  */
+#line 8498 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 612:
-#line 1958 "parser.yy" /* yacc.c:1652  */
+#line 1961 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprNary(LIST,(yyvsp[-1].number)));
 	}
-#line 8503 "parser.tab.c" /* yacc.c:1652  */
+#line 8506 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 613:
-#line 1963 "parser.yy" /* yacc.c:1652  */
+#line 1966 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[0]), (yylsp[0]), exprId((yyvsp[0].string)));
 	    (yyval.number) = 1;
 	}
-#line 8512 "parser.tab.c" /* yacc.c:1652  */
+#line 8515 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 614:
-#line 1967 "parser.yy" /* yacc.c:1652  */
+#line 1970 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprId((yyvsp[0].string)));
 	    (yyval.number) = (yyvsp[-2].number) + 1;
 	}
-#line 8521 "parser.tab.c" /* yacc.c:1652  */
+#line 8524 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 615:
-#line 1973 "parser.yy" /* yacc.c:1652  */
+#line 1976 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-2]), (yylsp[0]), exprNary(LIST,(yyvsp[-1].number)));
 	}
-#line 8529 "parser.tab.c" /* yacc.c:1652  */
+#line 8532 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 616:
-#line 1982 "parser.yy" /* yacc.c:1652  */
+#line 1985 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 0; }
-#line 8535 "parser.tab.c" /* yacc.c:1652  */
+#line 8538 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 618:
-#line 1987 "parser.yy" /* yacc.c:1652  */
+#line 1990 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = 1; }
-#line 8541 "parser.tab.c" /* yacc.c:1652  */
+#line 8544 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 619:
-#line 1988 "parser.yy" /* yacc.c:1652  */
+#line 1991 "parser.yy" /* yacc.c:1652  */
     { (yyval.number) = (yyvsp[-2].number)+1; }
-#line 8547 "parser.tab.c" /* yacc.c:1652  */
+#line 8550 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 620:
-#line 1992 "parser.yy" /* yacc.c:1652  */
+#line 1995 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprTrue());
 	}
-#line 8555 "parser.tab.c" /* yacc.c:1652  */
+#line 8558 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 622:
-#line 1999 "parser.yy" /* yacc.c:1652  */
+#line 2002 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprTrue());
 	}
-#line 8563 "parser.tab.c" /* yacc.c:1652  */
+#line 8566 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 626:
-#line 2008 "parser.yy" /* yacc.c:1652  */
+#line 2011 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprNary(LIST,(yyvsp[0].number)));
             CALL((yylsp[-1]), (yylsp[0]), exprBinary(SUP_VAR));
 	    CALL((yylsp[-1]), (yylsp[0]), property());
         }
-#line 8573 "parser.tab.c" /* yacc.c:1652  */
+#line 8576 "parser.tab.c" /* yacc.c:1652  */
     break;
 
   case 627:
-#line 2013 "parser.yy" /* yacc.c:1652  */
+#line 2016 "parser.yy" /* yacc.c:1652  */
     {
 	    CALL((yylsp[-1]), (yylsp[0]), exprNary(LIST,(yyvsp[0].number)));
             CALL((yylsp[-1]), (yylsp[0]), exprBinary(INF_VAR));
 	    CALL((yylsp[-1]), (yylsp[0]), property());
         }
-#line 8583 "parser.tab.c" /* yacc.c:1652  */
+#line 8586 "parser.tab.c" /* yacc.c:1652  */
     break;
 
 
-#line 8587 "parser.tab.c" /* yacc.c:1652  */
+#line 8590 "parser.tab.c" /* yacc.c:1652  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -8820,9 +8824,15 @@ yyreturn:
 #endif
   return yyresult;
 }
-#line 2019 "parser.yy" /* yacc.c:1918  */
+#line 2022 "parser.yy" /* yacc.c:1918  */
+
 
+/* Files are read through an input stream, which decodes compressed
+ * files while they are read.
+ */
+static InputStream *inputStream = NULL;
 
+#define YY_INPUT(buf, result, max_size) result = inputStream->read(buf, max_size)
 
 #include "lexer.cc"
 
@@ -8917,6 +8927,7 @@ static int32_t parseXTA(ParserBuilder *aParserBuilder,
     PositionTracker::setPath(ch, xpath);
 
     // Parse string
+    Statistics::Phase phase(Statistics::PARSING);
     int res = 0;
 
     if (utap_parse())
@@ -8940,6 +8951,7 @@ static int32_t parseProperty(ParserBuilder *aParserBuilder, const std::string& x
     // Reset position tracking
     PositionTracker::setPath(ch, xpath);
 
+    Statistics::Phase phase(Statistics::PARSING);
     return utap_parse() ? -1 : 0;
 }
 
@@ -8959,9 +8971,12 @@ int32_t parseXTA(const char *str, ParserBuilder *builder, bool newxta)
 
 int32_t parseXTA(FILE *file, ParserBuilder *builder, bool newxta)
 {
+    InputStream stream(file);
+    inputStream = &stream;
     utap__switch_to_buffer(utap__create_buffer(file, YY_BUF_SIZE));
     int res = parseXTA(builder, newxta, S_XTA, "");
     utap__delete_buffer(YY_CURRENT_BUFFER);
+    inputStream = NULL;
     return res;
 }
 
@@ -8976,8 +8991,11 @@ int32_t parseProperty(const char *str, ParserBuilder *aParserBuilder,
 
 int32_t parseProperty(FILE *file, ParserBuilder *aParserBuilder)
 {
+    InputStream stream(file);
+    inputStream = &stream;
     utap__switch_to_buffer(utap__create_buffer(file, YY_BUF_SIZE));
     int32_t res = parseProperty(aParserBuilder, "");
     utap__delete_buffer(YY_CURRENT_BUFFER);
+    inputStream = NULL;
     return res;
 }
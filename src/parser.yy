@@ -41,6 +41,7 @@
 
  #include "libparser.h"
  #include "utap/position.h"
+ #include "utap/statistics.h"
  #include <cstring>
 
  using namespace std;
@@ -74,6 +75,9 @@
  static int utap_lex()
  {
    int old;
+   if (ch->isAborted()) {
+	 return 0;
+   }
    if (syntax_token) {
 	 old = syntax_token;
 	 syntax_token = 0;
@@ -89,7 +93,7 @@
 
  #define YYERROR_VERBOSE 1
 
- #define CALL(first,last,call) do { ch->setPosition(first.start, last.end); try { ch->call; } catch (TypeException &te) { ch->handleError(te.what()); } } while (0)
+ #define CALL(first,last,call) do { Statistics::Phase phase(Statistics::BUILDING); ch->setPosition(first.start, last.end); try { ch->call; } catch (TypeException &te) { ch->handleError(te.what()); } } while (0)
 
  #define YY_(msg) utap_msg(msg)
 
@@ -2018,6 +2022,12 @@ Property:
 
 %%
 
+/* Files are read through an input stream, which decodes compressed
+ * files while they are read.
+ */
+static InputStream *inputStream = NULL;
+
+#define YY_INPUT(buf, result, max_size) result = inputStream->read(buf, max_size)
 
 #include "lexer.cc"
 
@@ -2112,6 +2122,7 @@ static int32_t parseXTA(ParserBuilder *aParserBuilder,
     PositionTracker::setPath(ch, xpath);
 
     // Parse string
+    Statistics::Phase phase(Statistics::PARSING);
     int res = 0;
 
     if (utap_parse())
@@ -2135,6 +2146,7 @@ static int32_t parseProperty(ParserBuilder *aParserBuilder, const std::string& x
     // Reset position tracking
     PositionTracker::setPath(ch, xpath);
 
+    Statistics::Phase phase(Statistics::PARSING);
     return utap_parse() ? -1 : 0;
 }
 
@@ -2154,9 +2166,12 @@ int32_t parseXTA(const char *str, ParserBuilder *builder, bool newxta)
 
 int32_t parseXTA(FILE *file, ParserBuilder *builder, bool newxta)
 {
+    InputStream stream(file);
+    inputStream = &stream;
     utap__switch_to_buffer(utap__create_buffer(file, YY_BUF_SIZE));
     int res = parseXTA(builder, newxta, S_XTA, "");
     utap__delete_buffer(YY_CURRENT_BUFFER);
+    inputStream = NULL;
     return res;
 }
 
@@ -2171,8 +2186,11 @@ int32_t parseProperty(const char *str, ParserBuilder *aParserBuilder,
 
 int32_t parseProperty(FILE *file, ParserBuilder *aParserBuilder)
 {
+    InputStream stream(file);
+    inputStream = &stream;
     utap__switch_to_buffer(utap__create_buffer(file, YY_BUF_SIZE));
     int32_t res = parseProperty(aParserBuilder, "");
     utap__delete_buffer(YY_CURRENT_BUFFER);
+    inputStream = NULL;
     return res;
 }
@@ -54,6 +54,11 @@ const Positions::line_t &Positions::find(
     return elements[first];
 }
 
+const string &Positions::intern(const string &text)
+{
+    return *texts.insert(text).first;
+}
+
 const Positions::line_t &Positions::find(uint32_t position) const
 {
     if (elements.size() == 0)
@@ -75,21 +80,33 @@ void Positions::dump()
     }
 }
 
+const Positions::line_t &UTAP::error_t::getStart() const
+{
+    return positions->find(position.start);
+}
+
+const Positions::line_t &UTAP::error_t::getEnd() const
+{
+    return positions->find(position.end);
+}
+
 std::ostream &operator <<(std::ostream &out, const UTAP::error_t &e)
 {
-    if (e.start.path.empty())
+    const Positions::line_t &start = e.getStart();
+    const Positions::line_t &end = e.getEnd();
+    if (start.path.empty())
     {
         out << e.message << " at line "
-            << e.start.line << " column " << (e.position.start - e.start.position)
+            << start.line << " column " << (e.position.start - start.position)
             << " to line "
-            << e.end.line << " column " << (e.position.end - e.end.position);
+            << end.line << " column " << (e.position.end - end.position);
     }
     else
     {
-        out << e.message << " in " << e.start.path << " at line "
-            << e.start.line << " column " << (e.position.start - e.start.position)
+        out << e.message << " in " << start.path << " at line "
+            << start.line << " column " << (e.position.start - start.position)
             << " to line "
-            << e.end.line << " column " << (e.position.end - e.end.position);
+            << end.line << " column " << (e.position.end - end.position);
     }
     return out;
 }
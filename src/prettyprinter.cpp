@@ -42,6 +42,97 @@ static const char *const prefix_label[] =
     "meta "
 };
 
+text_t::text_t(string text): node(std::make_shared<node_t>())
+{
+    node->text = std::move(text);
+}
+
+text_t::text_t(const char *text): text_t(string(text))
+{
+}
+
+text_t::text_t(char c): text_t(string(1, c))
+{
+}
+
+/* Releases the nodes below iteratively, since concatenating nested
+ * expressions gives deep trees.
+ */
+text_t::node_t::~node_t()
+{
+    std::vector<std::shared_ptr<node_t>> nodes;
+    nodes.push_back(std::move(left));
+    nodes.push_back(std::move(right));
+    while (!nodes.empty())
+    {
+        std::shared_ptr<node_t> n = std::move(nodes.back());
+        nodes.pop_back();
+        if (n && n.use_count() == 1)
+        {
+            nodes.push_back(std::move(n->left));
+            nodes.push_back(std::move(n->right));
+        }
+    }
+}
+
+text_t UTAP::operator+(const text_t &a, const text_t &b)
+{
+    if (!a.node)
+    {
+        return b;
+    }
+    if (!b.node)
+    {
+        return a;
+    }
+    text_t result;
+    result.node = std::make_shared<text_t::node_t>();
+    result.node->left = a.node;
+    result.node->right = b.node;
+    return result;
+}
+
+text_t &text_t::operator+=(const text_t &t)
+{
+    return *this = *this + t;
+}
+
+void text_t::write(ostream &os) const
+{
+    std::vector<const node_t *> nodes;
+    if (node)
+    {
+        nodes.push_back(node.get());
+    }
+    while (!nodes.empty())
+    {
+        const node_t *n = nodes.back();
+        nodes.pop_back();
+        if (n->left)
+        {
+            nodes.push_back(n->right.get());
+            nodes.push_back(n->left.get());
+        }
+        else
+        {
+            os << n->text;
+        }
+    }
+}
+
+string text_t::str() const
+{
+    ostringstream os;
+    write(os);
+    return os.str();
+}
+
+ostream &UTAP::operator<<(ostream &os, const text_t &t)
+{
+    t.write(os);
+    return os;
+}
+
 void PrettyPrinter::indent()
 {
     for (uint32_t i = 0; i < level; i++)
@@ -118,9 +209,9 @@ void PrettyPrinter::typeDouble(PREFIX prefix)
 void PrettyPrinter::typeBoundedInt(PREFIX prefix)
 {
     string l, u;
-    u = st.back();
+    u = st.back().str();
     st.pop_back();
-    l = st.back();
+    l = st.back().str();
     st.pop_back();
 
     string res;
@@ -146,7 +237,7 @@ void PrettyPrinter::typeVoid()
 
 void PrettyPrinter::typeScalar(PREFIX prefix)
 {
-    string size = st.back();
+    string size = st.back().str();
     st.pop_back();
     string res;
     res += prefix_label[prefix];
@@ -164,7 +255,7 @@ void PrettyPrinter::typeName(PREFIX prefix, const char *name)
 
 void PrettyPrinter::typeArrayOfSize(size_t n)
 {
-    array.push(st.back());
+    array.push(st.back().str());
     st.pop_back();
 }
 
@@ -221,7 +312,7 @@ void PrettyPrinter::declTypeDef(const char* name)
 
 void PrettyPrinter::declVar(const char *id, bool init)
 {
-    string i;
+    text_t i;
 
     if (init)
     {
@@ -249,7 +340,7 @@ void PrettyPrinter::declVar(const char *id, bool init)
 
 void PrettyPrinter::declInitialiserList(uint32_t num)
 {
-    string s = st.back();
+    text_t s = st.back();
     st.pop_back();
     while (--num)
     {
@@ -286,7 +377,7 @@ void PrettyPrinter::exprNary(kind_t kind, uint32_t num)
         throw TypeException("Invalid operator");
     }
 
-    string s = st.back();
+    text_t s = st.back();
     st.pop_back();
     while (--num)
     {
@@ -386,9 +477,9 @@ void PrettyPrinter::forBegin()
 
 void PrettyPrinter::forEnd()  // 3 expr, 1 stat
 {
-    string expr3 = st.back(); st.pop_back();
-    string expr2 = st.back(); st.pop_back();
-    string expr1 = st.back(); st.pop_back();
+    text_t expr3 = st.back(); st.pop_back();
+    text_t expr2 = st.back(); st.pop_back();
+    text_t expr1 = st.back(); st.pop_back();
     ostringstream *s = (ostringstream*)o.top();
     o.pop();
 
@@ -408,7 +499,7 @@ void PrettyPrinter::whileBegin()
 
 void PrettyPrinter::whileEnd()  // 1 expr, 1 stat
 {
-    string expr = st.back(); st.pop_back();
+    text_t expr = st.back(); st.pop_back();
     ostringstream *s = (ostringstream*)o.top();
     o.pop();
 
@@ -529,7 +620,7 @@ void PrettyPrinter::procState(const char *id, bool hasInvariant, bool hasExpRate
     level--;
 
     *o.top() << id;
-    string expRate; // pop expressions from stack in reverse order
+    text_t expRate; // pop expressions from stack in reverse order
     if (hasExpRate)
     {
         expRate = st.back();
@@ -779,7 +870,7 @@ void PrettyPrinter::exprCallBegin()
 
 void PrettyPrinter::exprCallEnd(uint32_t n)
 {
-    string s = ")";
+    text_t s = ")";
     while (n--)
     {
         s = st.back() + s;
@@ -794,7 +885,7 @@ void PrettyPrinter::exprCallEnd(uint32_t n)
 
 void PrettyPrinter::exprArray()
 {
-    string f = st.back();
+    text_t f = st.back();
     st.pop_back();
     st.back() += '[' + f + ']';
 }
@@ -878,10 +969,10 @@ void PrettyPrinter::exprBuiltinFunction3(kind_t kind)
 
 void PrettyPrinter::exprAssignment(kind_t op)
 {
-    string rhs = st.back(); st.pop_back();
-    string lhs = st.back(); st.pop_back();
+    text_t rhs = st.back(); st.pop_back();
+    text_t lhs = st.back(); st.pop_back();
 
-    st.push_back(string());
+    st.push_back(text_t());
     switch (op)
     {
     case ASSIGN:
@@ -924,9 +1015,9 @@ void PrettyPrinter::exprAssignment(kind_t op)
 
 void PrettyPrinter::exprUnary(kind_t op)
 {
-    string exp = st.back(); st.pop_back();
+    text_t exp = st.back(); st.pop_back();
 
-    st.push_back(string());
+    st.push_back(text_t());
     switch (op)
     {
     case MINUS:
@@ -963,10 +1054,10 @@ void PrettyPrinter::exprUnary(kind_t op)
 
 void PrettyPrinter::exprBinary(kind_t op)
 {
-    string exp2 = st.back(); st.pop_back();
-    string exp1 = st.back(); st.pop_back();
+    text_t exp2 = st.back(); st.pop_back();
+    text_t exp1 = st.back(); st.pop_back();
 
-    st.push_back(string());
+    st.push_back(text_t());
     switch (op)
     {
     case PO_CONTROL:
@@ -1064,13 +1155,13 @@ void PrettyPrinter::exprBinary(kind_t op)
 
 void PrettyPrinter::exprTernary(kind_t op, bool firstMissing)
 {
-    string exp3 = st.back(); st.pop_back();
-    string exp2 = st.back(); st.pop_back();
-    string exp1;
+    text_t exp3 = st.back(); st.pop_back();
+    text_t exp2 = st.back(); st.pop_back();
+    text_t exp1;
     if (firstMissing) exp1 = "1";
     else { exp1 = st.back(); st.pop_back(); }
 
-    st.push_back(string());
+    st.push_back(text_t());
     switch (op)
     {
     case CONTROL_TOPT:
@@ -1086,20 +1177,20 @@ void PrettyPrinter::exprTernary(kind_t op, bool firstMissing)
 
 void PrettyPrinter::exprInlineIf()
 {
-    string expr3 = st.back(); st.pop_back();
-    string expr2 = st.back(); st.pop_back();
-    string expr1 = st.back(); st.pop_back();
+    text_t expr3 = st.back(); st.pop_back();
+    text_t expr2 = st.back(); st.pop_back();
+    text_t expr1 = st.back(); st.pop_back();
 
-    st.push_back(string());
+    st.push_back(text_t());
     st.back() = expr1 + " ? " + expr2 + " : " + expr3;
 }
 
 void PrettyPrinter::exprComma()
 {
-    string expr2 = st.back(); st.pop_back();
-    string expr1 = st.back(); st.pop_back();
+    text_t expr2 = st.back(); st.pop_back();
+    text_t expr1 = st.back(); st.pop_back();
 
-    st.push_back(string());
+    st.push_back(text_t());
     st.back() = expr1 + ", " + expr2;
 }
 
@@ -1121,7 +1212,7 @@ void PrettyPrinter::exprForAllBegin(const char *name)
 
 void PrettyPrinter::exprForAllEnd(const char *name)
 {
-    string expr = st.back();
+    text_t expr = st.back();
     st.pop_back();
     st.back() += expr;
 }
@@ -1134,7 +1225,7 @@ void PrettyPrinter::exprExistsBegin(const char *name)
 
 void PrettyPrinter::exprExistsEnd(const char *name)
 {
-    string expr = st.back();
+    text_t expr = st.back();
     st.pop_back();
     st.back() += expr;
 }
@@ -1147,7 +1238,7 @@ void PrettyPrinter::exprSumBegin(const char *name)
 
 void PrettyPrinter::exprSumEnd(const char *name)
 {
-    string expr = st.back();
+    text_t expr = st.back();
     st.pop_back();
     st.back() += expr;
 }
@@ -1180,7 +1271,7 @@ void PrettyPrinter::instantiationBegin(const char *id, size_t, const char *templ
 void PrettyPrinter::instantiationEnd(const char* id, size_t parameters,
                                      const char* templ, size_t arguments)
 {
-    stack<string> s;
+    stack<text_t> s;
     while (arguments--)
     {
         s.push(st.back());
@@ -1223,10 +1314,10 @@ void PrettyPrinter::done(){}
 void PrettyPrinter::exprProbaQuantitative(Constants::kind_t type)
 {
     stringstream ss;
-    string pred2 = st.back(); st.pop_back();
-    string pred1 = st.back(); st.pop_back();
-    string bound = st.back(); st.pop_back();
-    string bounded = st.back(); st.pop_back();
+    text_t pred2 = st.back(); st.pop_back();
+    text_t pred1 = st.back(); st.pop_back();
+    text_t bound = st.back(); st.pop_back();
+    text_t bounded = st.back(); st.pop_back();
 /* FIXME
     ss << "Pr[" << (isTimedBound ? "time" : "steps") << "<="
        << bound << "](" << (type == BOX ? "[] " : "<> ");
@@ -1240,7 +1331,7 @@ void PrettyPrinter::exprProbaQuantitative(Constants::kind_t type)
 void PrettyPrinter::exprMitlDiamond (int low, int high)
 {
     stringstream ss;
-    string expr = st.back(); st.pop_back();
+    text_t expr = st.back(); st.pop_back();
 
     ss << "(<>[" << low << "," << high << "] " << expr << ")";
     st.push_back(ss.str());
@@ -1249,7 +1340,7 @@ void PrettyPrinter::exprMitlDiamond (int low, int high)
 void PrettyPrinter::exprMitlBox (int low, int high)
 {
     stringstream ss;
-    string expr = st.back(); st.pop_back();
+    text_t expr = st.back(); st.pop_back();
 
     ss << "([][" << low << "," << high << "] " << expr << ")";
     st.push_back(ss.str());
@@ -1260,18 +1351,18 @@ void PrettyPrinter::exprSimulate(int nbExpr,
                                  int nbOfAcceptingRuns)
 {
     stringstream ss;
-    string reachExpr = st.back();
+    text_t reachExpr = st.back();
     if (hasReach)
         st.pop_back();
 
-    stack<string> exprs;
+    stack<text_t> exprs;
     for (int i=0; i<nbExpr; i++)
     {
         exprs.push(st.back()); st.pop_back();
     }
-    string nbRuns = st.back(); st.pop_back();
-    string bound = st.back(); st.pop_back();
-    string boundedExpr = st.back(); st.pop_back();
+    text_t nbRuns = st.back(); st.pop_back();
+    text_t bound = st.back(); st.pop_back();
+    string boundedExpr = st.back().str(); st.pop_back();
     if (boundedExpr=="0")
         boundedExpr="#";
     else if (boundedExpr=="1")
@@ -1683,17 +1683,8 @@ void DistanceCalculator::updateDistancesFromProcess(const char* name,
 
 int DistanceCalculator::calcComplexity(const char* process)
 {
-    int result = 0;
-    list<instance_t> &ps(taSystem.getProcesses());
-    for (list<instance_t>::iterator i=ps.begin(), e=ps.end(); i!=e; ++i)
-    {
-        if (i->uid.getName()==process) {   
-            const template_t* temp = i->templ;
-            deque<edge_t>::const_iterator t = i->templ->edges.begin();
-            while (t != temp->edges.end()) { result++; t++; }
-        }
-    }
-    return result;
+    instance_t *instance = taSystem.findProcess(process);
+    return instance ? instance->templ->edges.size() : 0;
 }
 
 void DistanceCalculator::printProcsForDot(std::ostream &os, bool erd)
@@ -0,0 +1,125 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+#include "utap/statistics.h"
+
+#include <cassert>
+#include <ostream>
+
+using namespace UTAP;
+
+thread_local Statistics *Statistics::active = NULL;
+
+static const char *phaseNames[] = {
+    "xml_reading", "parsing", "building", "type_checking"
+};
+
+static const char *counterNames[] = {
+    "expressions", "types", "symbols", "frames", "positions", "errors",
+    "warnings"
+};
+
+Statistics::Statistics()
+{
+    reset();
+}
+
+void Statistics::reset()
+{
+    for (size_t i = 0; i < COUNTERS; i++)
+    {
+        counts[i] = 0;
+        bytes[i] = 0;
+    }
+    for (size_t i = 0; i < PHASES; i++)
+    {
+        times[i] = clock::duration::zero();
+    }
+    mark = clock::now();
+}
+
+double Statistics::getTime(phase_t phase) const
+{
+    return std::chrono::duration<double>(times[phase]).count();
+}
+
+uint64_t Statistics::getCount(counter_t counter) const
+{
+    return counts[counter];
+}
+
+uint64_t Statistics::getBytes(counter_t counter) const
+{
+    return bytes[counter];
+}
+
+const char *Statistics::getName(phase_t phase)
+{
+    return phaseNames[phase];
+}
+
+const char *Statistics::getName(counter_t counter)
+{
+    return counterNames[counter];
+}
+
+void Statistics::enter(phase_t phase)
+{
+    clock::time_point now = clock::now();
+    if (!phases.empty())
+    {
+        times[phases.back()] += now - mark;
+    }
+    phases.push_back(phase);
+    mark = now;
+}
+
+void Statistics::leave()
+{
+    assert(!phases.empty());
+    clock::time_point now = clock::now();
+    times[phases.back()] += now - mark;
+    phases.pop_back();
+    mark = now;
+}
+
+void Statistics::writeJSON(std::ostream &out) const
+{
+    out << "{\"times\": {";
+    for (size_t i = 0; i < PHASES; i++)
+    {
+        out << (i > 0 ? ", " : "") << '"' << phaseNames[i] << "\": "
+            << getTime((phase_t)i);
+    }
+    out << "}, \"counts\": {";
+    for (size_t i = 0; i < COUNTERS; i++)
+    {
+        out << (i > 0 ? ", " : "") << '"' << counterNames[i] << "\": "
+            << counts[i];
+    }
+    out << "}, \"bytes\": {";
+    for (size_t i = 0; i < COUNTERS; i++)
+    {
+        out << (i > 0 ? ", " : "") << '"' << counterNames[i] << "\": "
+            << bytes[i];
+    }
+    out << "}}";
+}
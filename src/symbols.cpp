@@ -23,10 +23,12 @@
 #include <cassert>
 #include <vector>
 #include <map>
+#include <atomic>
 #include <stdexcept>
 
 #include "utap/symbols.h"
 #include "utap/expression.h"
+#include "utap/statistics.h"
 
 using std::vector;
 using std::map;
@@ -120,11 +122,13 @@ uint32_t range_t::size() const
 
 struct symbol_t::symbol_data
 {
-    int32_t count;        // Reference counter
+    std::atomic<int32_t> count; // Reference counter
     void *frame;        // Uncounted pointer to containing frame
     type_t type;        // The type of the symbol
     void *user;                // User data
     string name;        // The name of the symbol
+    range_t range;      // Resolved value range (empty if unknown)
+    uint32_t elements;  // Resolved number of elements (0 if unknown)
 };
 
 symbol_t::symbol_t(void *frame, type_t type, const string& name, void *user)
@@ -135,6 +139,8 @@ symbol_t::symbol_t(void *frame, type_t type, const string& name, void *user)
     data->user = user;
     data->type = type;
     data->name = name;
+    data->elements = 0;
+    Statistics::record(Statistics::SYMBOLS, sizeof(symbol_data) + name.size());
 }
 
 /* Copy constructor */
@@ -150,26 +156,18 @@ symbol_t::symbol_t(const symbol_t &symbol)
 /* Destructor */
 symbol_t::~symbol_t()
 {
-    if (data)
+    if (data && --data->count == 0)
     {
-        data->count--;
-        if (data->count == 0)
-        {
-            delete data;
-        }
+        delete data;
     }
 }
 
 /* Assignment operator */
 const symbol_t &symbol_t::operator = (const symbol_t &symbol)
 {
-    if (data)
+    if (data && --data->count == 0)
     {
-        data->count--;
-        if (data->count == 0)
-        {
-            delete data;
-        }
+        delete data;
     }
     data = symbol.data;
     if (data)
@@ -210,6 +208,24 @@ type_t symbol_t::getType() const
 void symbol_t::setType(type_t type)
 {
     data->type = type;
+    data->range = range_t();
+    data->elements = 0;
+}
+
+range_t symbol_t::getRange() const
+{
+    return data->range;
+}
+
+uint32_t symbol_t::getElementCount() const
+{
+    return data->elements;
+}
+
+void symbol_t::setBounds(const range_t &range, uint32_t elements)
+{
+    data->range = range;
+    data->elements = elements;
 }
 
 /* Returns the user data of this symbol */
@@ -250,7 +266,7 @@ std::ostream &operator << (std::ostream &o, UTAP::symbol_t t)
 
 struct frame_t::frame_data
 {
-    int32_t count;                        // Reference count
+    std::atomic<int32_t> count;                // Reference count
     bool hasParent;                        // True if there is a parent
     frame_data *parent;                        // The parent frame data
     vector<symbol_t> symbols;                // The symbols in the frame
@@ -284,25 +300,17 @@ frame_t::frame_t(const frame_t &frame)
 /* Destructor */
 frame_t::~frame_t()
 {
-    if (data)
+    if (data && --data->count == 0)
     {
-        data->count--;
-        if (data->count == 0)
-        {
-            delete data;
-        }
+        delete data;
     }
 }
 
 const frame_t &frame_t::operator = (const frame_t &frame)
 {
-    if (data)
+    if (data && --data->count == 0)
     {
-        data->count--;
-        if (data->count == 0)
-        {
-            delete data;
-        }
+        delete data;
     }
     data = frame.data;
     if (data)
@@ -324,6 +332,11 @@ bool frame_t::operator != (const frame_t &frame) const
     return data != frame.data;
 }
 
+bool frame_t::operator < (const frame_t &frame) const
+{
+    return data < frame.data;
+}
+
 /* Returns the number of symbols in this frame */
 uint32_t frame_t::getSize() const
 {
@@ -476,6 +489,7 @@ frame_t frame_t::createFrame()
     frame_data *data = new frame_data;
     data->count = 0;
     data->hasParent = false;
+    Statistics::record(Statistics::FRAMES, sizeof(frame_data));
     data->parent = 0;
     return frame_t(data);
 }
@@ -486,6 +500,7 @@ frame_t frame_t::createFrame(const frame_t &parent)
     frame_data *data = new frame_data;
     data->count = 0;
     data->hasParent = true;
+    Statistics::record(Statistics::FRAMES, sizeof(frame_data));
     data->parent = parent.data;
     return frame_t(data);
 }
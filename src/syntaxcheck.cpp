@@ -22,6 +22,9 @@
 #include <vector>
 #include "utap/utap.h"
 #include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
 
 using UTAP::TimedAutomataSystem;
 using std::endl;
@@ -29,26 +32,61 @@ using std::cout;
 using std::cerr;
 using std::vector;
 
+static int synopsis()
+{
+    std::cerr << "Synopsis: check [-b] [-l] [-j threads] <filename>" << std::endl;
+    return 1;
+}
+
 int main(int argc, char *argv[])
 {
     try 
     {
         bool old = false;
+        int options = UTAP::XML_NO_OPTIONS;
+        size_t threads = 1;
+        int c;
         
-        if (argc < 2 || argc > 3)
+        while ((c = getopt(argc, argv, "blj:")) != -1)
         {
-            std::cerr << "Synopsis: check [-b] <filename>" << std::endl;
-            return 1;
+            switch (c)
+            {
+            case 'b':
+                old = true;
+                break;
+            case 'l':
+                options |= UTAP::XML_SKIP_LAYOUT;
+                break;
+            case 'j':
+                threads = std::max(1, atoi(optarg));
+                break;
+            default:
+                return synopsis();
+            }
         }
         
-        old = (strcmp(argv[1], "-b") == 0);
+        if (optind != argc - 1)
+        {
+            return synopsis();
+        }
         
         TimedAutomataSystem system;
-        const char *name = argv[argc - 1];
+        system.setTypeCheckThreads(threads);
+        const char *name = argv[optind];
+        
+        size_t length = strlen(name);
+        if (length > 3 && strcasecmp(".gz", name + length - 3) == 0)
+        {
+            length -= 3;
+        }
+        else if (length > 4 && strcasecmp(".zst", name + length - 4) == 0)
+        {
+            length -= 4;
+        }
         
-        if (strlen(name) > 4 && strcasecmp(".xml", name + strlen(name) - 4) == 0) 
+        if (length > 4 && strncasecmp(".xml", name + length - 4, 4) == 0) 
         {
-            parseXMLFile(name, &system, !old);
+            parseXMLFile(name, &system, !old, options);
         }
         else 
         {
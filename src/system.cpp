@@ -31,6 +31,9 @@
 #include <climits>
 #include <cassert>
 #include <sstream>
+#include <memory>
+#include <thread>
+#include <exception>
 
 using namespace UTAP;
 using namespace Constants;
@@ -71,6 +74,24 @@ function_t::~function_t()
     delete body;
 }
 
+/* Collects the iterators of the iteration statements, which are
+ * declared by the statements themselves.
+ */
+class CollectIteratorsVisitor : public AbstractStatementVisitor
+{
+private:
+    set<symbol_t> &iterators;
+public:
+    CollectIteratorsVisitor(set<symbol_t> &iterators)
+        : iterators(iterators) {}
+
+    int32_t visitIterationStatement(IterationStatement *stat) override
+    {
+        iterators.insert(stat->symbol);
+        return AbstractStatementVisitor::visitIterationStatement(stat);
+    }
+};
+
 string function_t::toString() const
 {
     string str = "";
@@ -91,9 +112,17 @@ string function_t::toString() const
         str = str.substr(0, str.size()-2);
     str += ")\n{\n";
 
+    set<symbol_t> iterators;
+    CollectIteratorsVisitor visitor(iterators);
+    body->accept(&visitor);
+
     std::list<variable_t>::const_iterator itr;
     for (itr = variables.begin(); itr != variables.end(); ++itr) // variables
     {
+        if (iterators.count(itr->uid))
+        {
+            continue;
+        }
         str += "    " + itr->toString();
         str += ";\n";
     }
@@ -138,102 +167,124 @@ bool declarations_t::addFunction(type_t type, const string& name, function_t *&f
 
 string declarations_t::toString(bool global) const
 {
-    string str = "";
-    str += getConstants();
-    str += "\n";
-    str += getTypeDefinitions();
-    str += "\n";
-    str += getVariables(global);
-    str += "\n";
-    str += getFunctions();
-    return str;
+    std::ostringstream os;
+    write(os, global);
+    return os.str();
 }
 
-string declarations_t::getConstants() const
+static void writeConstants(ostream &os, const declarations_t &decls)
 {
-    list<variable_t>::const_iterator v_itr = variables.begin();
-    string str = "";
+    list<variable_t>::const_iterator v_itr = decls.variables.begin();
     int i = 0;
     // constants
-    if (!variables.empty()){
-        while (v_itr != variables.end())
+    if (!decls.variables.empty()){
+        while (v_itr != decls.variables.end())
         {
             if (i == 0)
             {
-                str += "// constants\n";
+                os << "// constants\n";
                 i++;
             }
             if (v_itr->uid.getType().getKind() == CONSTANT)
             {
-                str += v_itr->toString();
-                str += ";\n";
+                os << v_itr->toString() << ";\n";
             }
             ++v_itr;
         }
     }
-    return str;
 }
 
-string declarations_t::getTypeDefinitions() const
+static void writeTypeDefinitions(ostream &os, const declarations_t &decls)
 {
-    string str = "";
     // type definitions
     int j = 0;
-    for (uint32_t i = 0; i < frame.getSize(); ++i)
+    for (uint32_t i = 0; i < decls.frame.getSize(); ++i)
     {
-        if (frame[i].getType().getKind() == TYPEDEF)
+        if (decls.frame[i].getType().getKind() == TYPEDEF)
         {
             if (j==0)
             {
-                str += "// type definitions\n";
+                os << "// type definitions\n";
                 j++;
             }
-            str += frame[i].getType().toDeclarationString() + ";\n";
+            os << decls.frame[i].getType().toDeclarationString() << ";\n";
         }
     }
-    return str;
 }
 
-string declarations_t::getVariables(bool global) const
+static void writeVariables(ostream &os, const declarations_t &decls, bool global)
 {
-    list<variable_t>::const_iterator v_itr = variables.begin();
-    string str = "";
+    list<variable_t>::const_iterator v_itr = decls.variables.begin();
     int i = 0;
     // variables
-    if (!variables.empty()){
+    if (!decls.variables.empty()){
         if (global) ++v_itr; // the first variable is "t(0)"
-        while (v_itr != variables.end())
+        while (v_itr != decls.variables.end())
         {
             if (i == 0)
             {
-                str += "// variables\n";
+                os << "// variables\n";
                 i++;
             }
             if (v_itr->uid.getType().getKind() != CONSTANT)
             {
-                str += v_itr->toString();
-                str += ";\n";
+                os << v_itr->toString() << ";\n";
             }
             ++v_itr;
         }
     }
-    return str;
 }
 
-string declarations_t::getFunctions() const
+static void writeFunctions(ostream &os, const declarations_t &decls)
 {
     list<function_t>::const_iterator f_itr;
-    string str = "";
     // functions
-    if (!functions.empty()){
-        str += "// functions\n";
-        for (f_itr = functions.begin(); f_itr != functions.end(); ++f_itr)
+    if (!decls.functions.empty()){
+        os << "// functions\n";
+        for (f_itr = decls.functions.begin(); f_itr != decls.functions.end(); ++f_itr)
         {
-            str += f_itr->toString();
-            str += "\n\n";
+            os << f_itr->toString() << "\n\n";
         }
     }
-    return str;
+}
+
+void declarations_t::write(ostream &os, bool global) const
+{
+    writeConstants(os, *this);
+    os << "\n";
+    writeTypeDefinitions(os, *this);
+    os << "\n";
+    writeVariables(os, *this, global);
+    os << "\n";
+    writeFunctions(os, *this);
+}
+
+string declarations_t::getConstants() const
+{
+    std::ostringstream os;
+    writeConstants(os, *this);
+    return os.str();
+}
+
+string declarations_t::getTypeDefinitions() const
+{
+    std::ostringstream os;
+    writeTypeDefinitions(os, *this);
+    return os.str();
+}
+
+string declarations_t::getVariables(bool global) const
+{
+    std::ostringstream os;
+    writeVariables(os, *this, global);
+    return os.str();
+}
+
+string declarations_t::getFunctions() const
+{
+    std::ostringstream os;
+    writeFunctions(os, *this);
+    return os.str();
 }
 
 std::string instance_t::writeMapping() const
@@ -322,6 +373,110 @@ branchpoint_t &template_t::addBranchpoint(const string& name)
     return branchpoint;
 }
 
+/* Builds a CSR index of edges by the node returned by the node
+ * function, which returns -1 for edges not incident to any node.
+ */
+template<class Node>
+static void buildIndex(edge_index_t &index, size_t nodes,
+                       const std::deque<edge_t> &edges, Node node)
+{
+    index.size = edges.size();
+    index.offsets.assign(nodes + 1, 0);
+    for (auto& edge: edges)
+    {
+        int32_t n = node(edge);
+        if (n >= 0)
+        {
+            index.offsets[n + 1]++;
+        }
+    }
+    for (size_t n = 0; n < nodes; n++)
+    {
+        index.offsets[n + 1] += index.offsets[n];
+    }
+    index.edges.resize(index.offsets[nodes]);
+    vector<uint32_t> next(index.offsets.begin(), index.offsets.end() - 1);
+    uint32_t i = 0;
+    for (auto& edge: edges)
+    {
+        int32_t n = node(edge);
+        if (n >= 0)
+        {
+            index.edges[next[n]++] = i;
+        }
+        i++;
+    }
+}
+
+void template_t::buildEdgeIndex()
+{
+    buildIndex(outgoing, states.size(), edges, [](const edge_t &e) {
+        return e.src ? e.src->locNr : -1;
+    });
+    buildIndex(incoming, states.size(), edges, [](const edge_t &e) {
+        return e.dst ? e.dst->locNr : -1;
+    });
+    buildIndex(outgoingb, branchpoints.size(), edges, [](const edge_t &e) {
+        return e.srcb ? e.srcb->bpNr : -1;
+    });
+    buildIndex(incomingb, branchpoints.size(), edges, [](const edge_t &e) {
+        return e.dstb ? e.dstb->bpNr : -1;
+    });
+}
+
+/* Returns the edges of a node in the index, or an empty range if
+ * the node is not in the index.
+ */
+static edge_range_t getEdges(std::deque<edge_t> &edges,
+                             const edge_index_t &index, int32_t node)
+{
+    if (node < 0 || (size_t)node + 1 >= index.offsets.size())
+    {
+        return edge_range_t(&edges, nullptr, nullptr);
+    }
+    const uint32_t *first = index.edges.data();
+    return edge_range_t(&edges,
+                        first + index.offsets[node],
+                        first + index.offsets[node + 1]);
+}
+
+/* Rebuilds the edge indices if locations, branchpoints or edges have
+ * been added since they were built.
+ */
+void template_t::updateEdgeIndex()
+{
+    if (outgoing.offsets.size() != states.size() + 1
+        || outgoingb.offsets.size() != branchpoints.size() + 1
+        || outgoing.size != edges.size())
+    {
+        buildEdgeIndex();
+    }
+}
+
+edge_range_t template_t::getOutgoingEdges(const state_t &state)
+{
+    updateEdgeIndex();
+    return getEdges(edges, outgoing, state.locNr);
+}
+
+edge_range_t template_t::getIncomingEdges(const state_t &state)
+{
+    updateEdgeIndex();
+    return getEdges(edges, incoming, state.locNr);
+}
+
+edge_range_t template_t::getOutgoingEdges(const branchpoint_t &branchpoint)
+{
+    updateEdgeIndex();
+    return getEdges(edges, outgoingb, branchpoint.bpNr);
+}
+
+edge_range_t template_t::getIncomingEdges(const branchpoint_t &branchpoint)
+{
+    updateEdgeIndex();
+    return getEdges(edges, incomingb, branchpoint.bpNr);
+}
+
 edge_t &template_t::addEdge(symbol_t src, symbol_t dst, bool control, const string& actname)
 {
     int32_t nr = edges.empty() ? 0 : edges.back().nr + 1;
@@ -412,40 +567,12 @@ condition_t &template_t::addCondition(vector<symbol_t> anchors, int loc,
 }
 
 
-static deque<int> messages_nr(deque<message_t> messages)
-{
-    deque<message_t>::iterator itr;
-    deque<int> d;
-
-    for (itr = messages.begin(); itr != messages.end(); ++itr)
-    {
-        d.push_back(itr->nr);
-    }
-    return d;
-}
-
-static deque<int> conditions_nr(deque<condition_t> conditions)
-{
-    deque<condition_t>::iterator itr;
-    deque<int> d;
-
-    for (itr = conditions.begin(); itr != conditions.end(); ++itr)
-    {
-        d.push_back(itr->nr);
-    }
-    return d;
-}
-
-static deque<int> updates_nr(deque<update_t> updates)
+/* Returns the key of an instance line and a location in the
+ * simregion indices.
+ */
+static uint64_t simregionKey(const instanceLine_t *instance, int y)
 {
-    deque<update_t>::iterator itr;
-    deque<int> d;
-
-    for (itr = updates.begin(); itr != updates.end(); ++itr)
-    {
-        d.push_back(itr->nr);
-    }
-    return d;
+    return (uint64_t)(uint32_t)instance->instanceNr << 32 | (uint32_t)y;
 }
 
 /**
@@ -459,131 +586,106 @@ static deque<int> updates_nr(deque<update_t> updates)
  */
 const vector<simregion_t> template_t::getSimregions()
 {
-    // cout <<"=======LSC: getSimregions=======\n";
     /**
-     * we copy the messages, conditions and updates from the scenario
+     * index the first condition and update on each instance line and
+     * location, as found by getCondition() and getUpdate()
      */
-    deque<int> m_nr = messages_nr(messages);
-    deque<int> c_nr = conditions_nr(conditions);
-    deque<int> u_nr = updates_nr(updates);
+    std::unordered_map<uint64_t, size_t> conditionIndex;
+    std::unordered_map<uint64_t, size_t> updateIndex;
+    for (size_t i = 0; i < conditions.size(); ++i)
+    {
+        for (auto anchor: conditions[i].anchors)
+        {
+            conditionIndex.emplace(simregionKey(anchor, conditions[i].location), i);
+        }
+    }
+    for (size_t i = 0; i < updates.size(); ++i)
+    {
+        updateIndex.emplace(simregionKey(updates[i].anchor, updates[i].location), i);
+    }
 
-    deque<int>::iterator m_itr;
-    deque<int>::iterator c_itr;
-    deque<int>::iterator u_itr;
+    vector<bool> usedCondition(conditions.size(), false);
+    vector<bool> usedUpdate(updates.size(), false);
+    auto condition = [&](simregion_t &s, instanceLine_t *instance, int y) {
+        auto i = conditionIndex.find(simregionKey(instance, y));
+        if (i == conditionIndex.end())
+        {
+            return false;
+        }
+        s.condition = &conditions[i->second];
+        usedCondition[i->second] = true;
+        return true;
+    };
+    auto update = [&](simregion_t &s, instanceLine_t *instance, int y) {
+        auto i = updateIndex.find(simregionKey(instance, y));
+        if (i == updateIndex.end())
+        {
+            return false;
+        }
+        s.update = &updates[i->second];
+        usedUpdate[i->second] = true;
+        return true;
+    };
 
     vector<simregion_t> simregions;
-    simregion_t s;
-    instanceLine_t *source;
-    instanceLine_t *target;
-    int y;
-    int nr = 0;
+    simregions.reserve(messages.size() + conditions.size() + updates.size());
 
     /**
      * iterates over messages
      */
-    for (m_itr = m_nr.begin(); m_itr!=m_nr.end(); ++m_itr)
+    for (auto& message: messages)
     {
-        simregion_t s = simregion_t();
-        s.setMessage(messages, *m_itr);
+        simregion_t s;
+        s.message = &message;
 
-        source = s.message->src;
-        target = s.message->dst;
-        y = s.message->location;
+        int y = message.location;
         /**
          * we give priority to the condition on the target, if there is also one
          * in the source, it must be part of another simregion
          */
-        if (getCondition(target, y, s.condition))
-        {
-            for (c_itr = c_nr.begin(); c_itr != c_nr.end(); ++c_itr)
-            {
-                if (*c_itr == s.condition->nr)
-                {
-                    c_nr.erase(c_itr);
-                    break;
-                }
-            }
-        }
-        else if (getCondition(source, y, s.condition))
-        {
-            for (c_itr = c_nr.begin(); c_itr != c_nr.end(); ++c_itr)
-            {
-                if (*c_itr == s.condition->nr)
-                {
-                    c_nr.erase(c_itr);
-                    break;
-                }
-            }
-        }
-        if (getUpdate(target, y, s.update))
-        {
-            for (u_itr = u_nr.begin(); u_itr != u_nr.end(); ++u_itr)
-            {
-                if (*u_itr == s.update->nr)
-                {
-                    u_nr.erase(u_itr);
-                    break;
-                }
-            }
-        }
-        else if (getUpdate(source, y, s.update))
-        {
-            for (u_itr = u_nr.begin(); u_itr != u_nr.end(); ++u_itr)
-            {
-                if (*u_itr == s.update->nr)
-                {
-                    u_nr.erase(u_itr);
-                    break;
-                }
-            }
-        }
-        s.nr = nr;
+        condition(s, message.dst, y) || condition(s, message.src, y);
+        update(s, message.dst, y) || update(s, message.src, y);
+        s.nr = simregions.size();
         simregions.push_back(s);
-        nr++;
     }
 
     /**
      * iterates over remaining conditions
      */
-    for (c_itr = c_nr.begin(); c_itr != c_nr.end(); ++c_itr)
+    for (size_t i = 0; i < conditions.size(); ++i)
     {
-        s = simregion_t();
-        s.setCondition(conditions, *c_itr);
+        if (usedCondition[i])
+        {
+            continue;
+        }
+        simregion_t s;
+        s.condition = &conditions[i];
 
-        y = s.condition->location;
-        if (getUpdate(s.condition->anchors, y, s.update))
+        for (auto anchor: s.condition->anchors)
         {
-            for (u_itr = u_nr.begin(); u_itr != u_nr.end(); ++u_itr)
+            if (update(s, anchor, s.condition->location))
             {
-                if (*u_itr == s.update->nr)
-                {
-                    u_nr.erase(u_itr);
-                    break;
-                }
+                break;
             }
         }
-        s.nr = nr;
+        s.nr = simregions.size();
         simregions.push_back(s);
-        nr++;
     }
 
     /**
      * iterates over remaining updates
      */
-    for (u_itr = u_nr.begin(); u_itr != u_nr.end(); ++u_itr)
+    for (size_t i = 0; i < updates.size(); ++i)
     {
-        s = simregion_t();
-        s.setUpdate(updates, *u_itr);
-        s.nr = nr;
-        simregions.push_back(s);
-        nr++;
+        if (!usedUpdate[i])
+        {
+            simregion_t s;
+            s.update = &updates[i];
+            s.nr = simregions.size();
+            simregions.push_back(s);
+        }
     }
 
-    /*// cout << "-----unordered simregions-----\n";
-    for (unsigned int i = 0; i < simregions.size(); ++i){
-        // cout << simregions[i].toString() << " " << simregions[i].nr<< "\n";
-    } //test OK*/
-
     return simregions;
 }
 
@@ -684,20 +786,20 @@ vector<simregion_t> instanceLine_t::getSimregions(const vector<simregion_t>& sim
     //get the simregions anchored to this instance
     for (itr = simregions.begin(); itr != simregions.end(); ++itr) {
         message_t* m = itr->message;
-        if (m->nr != -1 && (m->src->instanceNr == this->instanceNr
+        if (m && (m->src->instanceNr == this->instanceNr
                 || m->dst->instanceNr == this->instanceNr) ) {
             i_simregions.push_back(*itr);
             continue;
         }
 
         update_t* u = itr->update;
-        if ( u->nr != -1 && u->anchor->instanceNr == this->instanceNr ) {
+        if (u && u->anchor->instanceNr == this->instanceNr ) {
             i_simregions.push_back(*itr);
             continue;
         }
 
         condition_t* c = itr->condition;
-        if (c->nr != -1) {
+        if (c) {
             for (it = c->anchors.begin(); it !=c->anchors.end(); ++it) {
                 instance = *it;
                 if (instance->instanceNr == this->instanceNr) {
@@ -722,15 +824,15 @@ vector<simregion_t> instanceLine_t::getSimregions(const vector<simregion_t>& sim
 
 int simregion_t::getLoc() const
 {
-    if (this->message->nr != -1)
+    if (hasMessage())
     {
         return this->message->location;
     }
-    if (this->condition->nr != -1)
+    if (hasCondition())
     {
         return this->condition->location;
     }
-    if (this->update->nr != -1)
+    if (hasUpdate())
     {
         return this->update->location;
     }
@@ -739,61 +841,31 @@ int simregion_t::getLoc() const
 
 bool simregion_t::isInPrechart() const
 {
-    if (this->message && this->message->nr != -1)
+    if (hasMessage())
     {
         return this->message->isInPrechart;
     }
-    if (this->condition && this->condition->nr != -1)
+    if (hasCondition())
     {
         return this->condition->isInPrechart;
     }
-    if (this->update && this->update->nr != -1)
+    if (hasUpdate())
     {
         return this->update->isInPrechart;
     }
     return false;//should not happen
 }
 
-void simregion_t::setMessage(std::deque<message_t>& messages, int nr) {
-    std::deque<message_t>::iterator i;
-    for (i = messages.begin(); i != messages.end(); ++i) {
-        if (i->nr == nr){
-            this->message = &(*i);
-            return;
-        }
-    }
-}
-
-void simregion_t::setCondition(std::deque<condition_t>& conditions, int nr) {
-    std::deque<condition_t>::iterator i;
-    for (i = conditions.begin(); i != conditions.end(); ++i) {
-        if (i->nr == nr){
-            this->condition = &(*i);
-            return;
-        }
-    }
-}
-
-void simregion_t::setUpdate(std::deque<update_t>& updates, int nr) {
-    std::deque<update_t>::iterator i;
-    for (i = updates.begin(); i != updates.end(); ++i) {
-        if (i->nr == nr){
-            this->update = &(*i);
-            return;
-        }
-    }
-}
-
 std::string simregion_t::toString() const {
     std::string s="s(";
-    if (message->nr != -1) {
+    if (hasMessage()) {
         s += ("m:" + message->label.toString() + " ");
     }
-    if (condition->nr != -1) {
+    if (hasCondition()) {
         std::string b = (condition->isHot) ? " HOT " : "";
         s += ("c:" + b + (condition->label.toString()) + " ");
     }
-    if (update->nr != -1) {
+    if (hasUpdate()) {
         s += ("u:" + update->label.toString() + " ");
     }
     s = s.substr(0, s.size()-1);
@@ -802,23 +874,47 @@ std::string simregion_t::toString() const {
 }
 
 
-void cut_t::erase(simregion_t s) {
-    std::vector<simregion_t>::iterator sim;
-    for (sim = simregions.begin(); sim != simregions.end(); ++sim) {
-        if (sim->nr == s.nr) {
-            simregions.erase(sim);
+void cut_t::set(int nr)
+{
+    assert(nr >= 0);
+    size_t word = nr / 64;
+    if (word >= bits.size())
+    {
+        bits.resize(word + 1, 0);
+    }
+    bits[word] |= uint64_t(1) << (nr % 64);
+}
+
+void cut_t::erase(const simregion_t& s)
+{
+    if (!contains(s))
+    {
+        return;
+    }
+    bits[s.nr / 64] &= ~(uint64_t(1) << (s.nr % 64));
+    while (!bits.empty() && bits.back() == 0)
+    {
+        bits.pop_back();
+    }
+    for (auto& sim: simregions)
+    {
+        if (sim.nr == s.nr)
+        {
+            sim = simregions.back();
+            simregions.pop_back();
             return;
         }
     }
 }
-bool cut_t::contains(simregion_t s) {
-    std::vector<simregion_t>::iterator sim;
-    for (sim = simregions.begin(); sim != simregions.end(); ++sim) {
-        if (sim->nr == s.nr) {
-            return true;
-        }
+
+size_t cut_t::hash() const
+{
+    size_t h = 14695981039346656037ULL;
+    for (uint64_t word: bits)
+    {
+        h = (h ^ word) * 1099511628211ULL;
     }
-    return false;
+    return h;
 }
 
 /**
@@ -861,29 +957,6 @@ bool cut_t::isInPrechart() const
     return true;
 }
 
-bool cut_t::equals(const cut_t& y) const {
-    std::vector<simregion_t>::const_iterator s;
-    std::vector<simregion_t>::iterator sim;
-    int xsize = simregions.size();
-    int ysize = y.simregions.size();
-    if ( xsize != ysize)
-        return false;
-    std::vector<simregion_t> ycopy = std::vector<simregion_t>(y.simregions);
-    for (s = simregions.begin(); s != simregions.end(); ++s)
-    {
-        for (sim = ycopy.begin(); sim != ycopy.end(); ++sim)
-        {
-            if (sim->nr == s->nr)
-            {
-                ycopy.erase(sim);
-                break;
-            }
-        }
-    }
-    return (ycopy.empty()) ? true : false;
-}
-
-
 /**
  * return true if the LSC is of invariant mode
  */
@@ -932,15 +1005,572 @@ TimedAutomataSystem::TimedAutomataSystem(): syncUsed(UTAP::sync_use_t::unused)
     modified = false;
 }
 
-TimedAutomataSystem::TimedAutomataSystem(const TimedAutomataSystem& ta)
+/**
+ * Copies the parts of a system into another system. Symbols, frames,
+ * types, expressions and statements are copied at most once, so any
+ * sharing in the original is preserved in the copy. Types without
+ * expressions are immutable and therefore shared rather than copied;
+ * expressions are always copied as the type checker annotates them.
+ *
+ * The objects the user data of symbols point to (variables,
+ * locations, functions, instances, etc.) are registered as they are
+ * copied, and the user data of the copied symbols is redirected to
+ * them by finish().
+ */
+class SystemCopier : public StatementVisitor
+{
+private:
+    map<symbol_t, symbol_t> symbols;
+    map<frame_t, frame_t> frames;
+    map<type_t, type_t> types;
+    map<expression_t, expression_t> expressions;
+    map<const void*, void*> objects;
+    vector<pair<symbol_t, symbol_t>> copied; /**< Symbols and copies */
+    Statement *result{nullptr};              /**< Result of visitor */
+
+    /* Records that \a to is the copy of \a from and gives it a copy
+     * of the type of \a from.
+     */
+    void record(symbol_t from, symbol_t to)
+    {
+        symbols[from] = to;
+        copied.emplace_back(from, to);
+        to.setType(type(from.getType()));
+        to.setBounds(from.getRange(), from.getElementCount());
+    }
+
+    void block(BlockStatement *from, BlockStatement *to)
+    {
+        copy(*from, *to);
+        for (auto stat: *from)
+        {
+            to->push_stat(statement(stat));
+        }
+        result = to;
+    }
+
+public:
+    /** Registers \a to as the copy of \a from. */
+    template<class T>
+    void add(const T *from, T *to)
+    {
+        objects[from] = to;
+    }
+
+    /** Returns the copy of \a from, or \a from if it has no copy. */
+    template<class T>
+    T *object(T *from) const
+    {
+        auto i = objects.find(from);
+        return i == objects.end() ? from : static_cast<T*>(i->second);
+    }
+
+    symbol_t symbol(symbol_t from)
+    {
+        if (from == symbol_t())
+        {
+            return from;
+        }
+        auto i = symbols.find(from);
+        if (i != symbols.end())
+        {
+            return i->second;
+        }
+
+        /* The symbol is not in any of the frames of the system
+         * (e.g. the variable of a quantifier), so it gets its own.
+         */
+        symbol_t to = frame_t::createFrame().addSymbol(from.getName(), type_t());
+        record(from, to);
+        return to;
+    }
+
+    set<symbol_t> symbolSet(const set<symbol_t> &from)
+    {
+        set<symbol_t> to;
+        for (auto& s: from)
+        {
+            to.insert(symbol(s));
+        }
+        return to;
+    }
+
+    frame_t frame(frame_t from)
+    {
+        if (from == frame_t())
+        {
+            return from;
+        }
+        auto i = frames.find(from);
+        if (i != frames.end())
+        {
+            return i->second;
+        }
+
+        frame_t to = from.hasParent()
+            ? frame_t::createFrame(frame(from.getParent()))
+            : frame_t::createFrame();
+        frames[from] = to;
+
+        /* Create the symbols before copying their types, as the
+         * types may refer to other symbols of the frame.
+         */
+        vector<pair<symbol_t, symbol_t>> created;
+        for (uint32_t i = 0; i < from.getSize(); i++)
+        {
+            auto j = symbols.find(from[i]);
+            if (j != symbols.end())
+            {
+                to.add(j->second);
+            }
+            else
+            {
+                symbol_t s = to.addSymbol(from[i].getName(), type_t());
+                symbols[from[i]] = s;
+                created.emplace_back(from[i], s);
+            }
+        }
+        for (auto& c: created)
+        {
+            record(c.first, c.second);
+        }
+        return to;
+    }
+
+    type_t type(type_t from)
+    {
+        auto i = types.find(from);
+        if (i != types.end())
+        {
+            return i->second;
+        }
+        type_t to = from.rebuild([this](type_t t) { return type(t); },
+                                 [this](expression_t e) { return expr(e); });
+        types[from] = to;
+        return to;
+    }
+
+    expression_t expr(expression_t from)
+    {
+        if (from.empty())
+        {
+            return from;
+        }
+        auto i = expressions.find(from);
+        if (i != expressions.end())
+        {
+            return i->second;
+        }
+        expression_t to = from.rebuild(
+            [this](expression_t e) { return expr(e); },
+            [this](symbol_t s) { return symbol(s); },
+            [this](type_t t) { return type(t); });
+        expressions[from] = to;
+        return to;
+    }
+
+    Statement *statement(Statement *from)
+    {
+        if (from == nullptr)
+        {
+            return nullptr;
+        }
+        from->accept(this);
+        return result;
+    }
+
+    void copy(const variable_t &from, variable_t &to)
+    {
+        add(&from, &to);
+        to.uid = symbol(from.uid);
+        to.expr = expr(from.expr);
+    }
+
+    void copy(const function_t &from, function_t &to)
+    {
+        add(&from, &to);
+        to.uid = symbol(from.uid);
+        to.body = static_cast<BlockStatement*>(statement(from.body));
+        to.changes = symbolSet(from.changes);
+        to.depends = symbolSet(from.depends);
+        for (auto& v: from.variables)
+        {
+            to.variables.emplace_back();
+            copy(v, to.variables.back());
+        }
+    }
+
+    void copy(const declarations_t &from, declarations_t &to)
+    {
+        to.frame = frame(from.frame);
+        for (auto& v: from.variables)
+        {
+            to.variables.emplace_back();
+            copy(v, to.variables.back());
+        }
+        for (auto& f: from.functions)
+        {
+            to.functions.emplace_back();
+            copy(f, to.functions.back());
+        }
+        for (auto& p: from.progress)
+        {
+            to.progress.push_back({expr(p.guard), expr(p.measure)});
+        }
+        for (auto& d: from.iodecl)
+        {
+            to.iodecl.emplace_back();
+            iodecl_t &io = to.iodecl.back();
+            io.instanceName = d.instanceName;
+            for (auto& e: d.param)
+                io.param.push_back(expr(e));
+            for (auto& e: d.inputs)
+                io.inputs.push_back(expr(e));
+            for (auto& e: d.outputs)
+                io.outputs.push_back(expr(e));
+            for (auto& e: d.csp)
+                io.csp.push_back(expr(e));
+        }
+        for (auto& g: from.ganttChart)
+        {
+            to.ganttChart.emplace_back(g.name);
+            gantt_t &gantt = to.ganttChart.back();
+            gantt.parameters = frame(g.parameters);
+            for (auto& m: g.mapping)
+            {
+                ganttmap_t map;
+                map.parameters = frame(m.parameters);
+                map.predicate = expr(m.predicate);
+                map.mapping = expr(m.mapping);
+                gantt.mapping.push_back(map);
+            }
+        }
+    }
+
+    void copy(const instance_t &from, instance_t &to)
+    {
+        add(&from, &to);
+        to.uid = symbol(from.uid);
+        to.parameters = frame(from.parameters);
+        for (auto& m: from.mapping)
+        {
+            to.mapping[symbol(m.first)] = expr(m.second);
+        }
+        to.arguments = from.arguments;
+        to.unbound = from.unbound;
+        to.templ = object(from.templ);
+        to.restricted = symbolSet(from.restricted);
+    }
+
+    void copy(const template_t &from, template_t &to)
+    {
+        add(&from, &to);
+        copy(static_cast<const instance_t&>(from), static_cast<instance_t&>(to));
+        copy(static_cast<const declarations_t&>(from), static_cast<declarations_t&>(to));
+        to.init = symbol(from.init);
+        to.templateset = frame(from.templateset);
+        for (auto& s: from.states)
+        {
+            to.states.emplace_back();
+            state_t &state = to.states.back();
+            add(&s, &state);
+            state.uid = symbol(s.uid);
+            state.invariant = expr(s.invariant);
+            state.exponentialRate = expr(s.exponentialRate);
+            state.costRate = expr(s.costRate);
+            state.locNr = s.locNr;
+        }
+        for (auto& b: from.branchpoints)
+        {
+            to.branchpoints.emplace_back();
+            branchpoint_t &branchpoint = to.branchpoints.back();
+            add(&b, &branchpoint);
+            branchpoint.uid = symbol(b.uid);
+            branchpoint.bpNr = b.bpNr;
+        }
+        for (auto& e: from.edges)
+        {
+            to.edges.emplace_back();
+            edge_t &edge = to.edges.back();
+            edge.nr = e.nr;
+            edge.control = e.control;
+            edge.actname = e.actname;
+            edge.src = object(e.src);
+            edge.srcb = object(e.srcb);
+            edge.dst = object(e.dst);
+            edge.dstb = object(e.dstb);
+            edge.select = frame(e.select);
+            edge.guard = expr(e.guard);
+            edge.assign = expr(e.assign);
+            edge.sync = expr(e.sync);
+#ifdef ENABLE_PROB
+            edge.prob = expr(e.prob);
+#endif
+            edge.selectValues = e.selectValues;
+        }
+        for (auto& e: from.dynamicEvals)
+        {
+            to.dynamicEvals.push_back(expr(e));
+        }
+        to.isTA = from.isTA;
+        to.outgoing = from.outgoing;
+        to.incoming = from.incoming;
+        to.outgoingb = from.outgoingb;
+        to.incomingb = from.incomingb;
+        for (auto& i: from.instances)
+        {
+            to.instances.emplace_back();
+            copy(i, to.instances.back());
+            to.instances.back().instanceNr = i.instanceNr;
+        }
+        for (auto& m: from.messages)
+        {
+            to.messages.emplace_back();
+            message_t &message = to.messages.back();
+            message.nr = m.nr;
+            message.location = m.location;
+            message.src = object(m.src);
+            message.dst = object(m.dst);
+            message.label = expr(m.label);
+            message.isInPrechart = m.isInPrechart;
+        }
+        for (auto& u: from.updates)
+        {
+            to.updates.emplace_back();
+            update_t &update = to.updates.back();
+            update.nr = u.nr;
+            update.location = u.location;
+            update.anchor = object(u.anchor);
+            update.label = expr(u.label);
+            update.isInPrechart = u.isInPrechart;
+        }
+        for (auto& c: from.conditions)
+        {
+            to.conditions.emplace_back();
+            condition_t &condition = to.conditions.back();
+            condition.nr = c.nr;
+            condition.location = c.location;
+            for (auto anchor: c.anchors)
+            {
+                condition.anchors.push_back(object(anchor));
+            }
+            condition.label = expr(c.label);
+            condition.isInPrechart = c.isInPrechart;
+            condition.isHot = c.isHot;
+        }
+        to.type = from.type;
+        to.mode = from.mode;
+        to.hasPrechart = from.hasPrechart;
+        to.dynamic = from.dynamic;
+        to.dynindex = from.dynindex;
+        to.isDefined = from.isDefined;
+    }
+
+    /** Redirects the user data of the copied symbols to the copies. */
+    void finish()
+    {
+        for (auto& c: copied)
+        {
+            c.second.setData(object(c.first.getData()));
+        }
+    }
+
+    int32_t visitEmptyStatement(EmptyStatement *) override
+    {
+        result = new EmptyStatement();
+        return 0;
+    }
+
+    int32_t visitExprStatement(ExprStatement *stat) override
+    {
+        result = new ExprStatement(expr(stat->expr));
+        return 0;
+    }
+
+    int32_t visitAssertStatement(AssertStatement *stat) override
+    {
+        result = new AssertStatement(expr(stat->expr));
+        return 0;
+    }
+
+    int32_t visitForStatement(ForStatement *stat) override
+    {
+        expression_t init = expr(stat->init);
+        expression_t cond = expr(stat->cond);
+        expression_t step = expr(stat->step);
+        result = new ForStatement(init, cond, step, statement(stat->stat));
+        return 0;
+    }
+
+    int32_t visitIterationStatement(IterationStatement *stat) override
+    {
+        frame_t frame = this->frame(stat->getFrame());
+        symbol_t symbol = this->symbol(stat->symbol);
+        result = new IterationStatement(symbol, frame, statement(stat->stat));
+        return 0;
+    }
+
+    int32_t visitWhileStatement(WhileStatement *stat) override
+    {
+        expression_t cond = expr(stat->cond);
+        result = new WhileStatement(cond, statement(stat->stat));
+        return 0;
+    }
+
+    int32_t visitDoWhileStatement(DoWhileStatement *stat) override
+    {
+        Statement *body = statement(stat->stat);
+        result = new DoWhileStatement(body, expr(stat->cond));
+        return 0;
+    }
+
+    int32_t visitBlockStatement(BlockStatement *stat) override
+    {
+        block(stat, new BlockStatement(frame(stat->getFrame())));
+        return 0;
+    }
+
+    int32_t visitSwitchStatement(SwitchStatement *stat) override
+    {
+        frame_t frame = this->frame(stat->getFrame());
+        block(stat, new SwitchStatement(frame, expr(stat->cond)));
+        return 0;
+    }
+
+    int32_t visitCaseStatement(CaseStatement *stat) override
+    {
+        frame_t frame = this->frame(stat->getFrame());
+        block(stat, new CaseStatement(frame, expr(stat->cond)));
+        return 0;
+    }
+
+    int32_t visitDefaultStatement(DefaultStatement *stat) override
+    {
+        block(stat, new DefaultStatement(frame(stat->getFrame())));
+        return 0;
+    }
+
+    int32_t visitIfStatement(IfStatement *stat) override
+    {
+        expression_t cond = expr(stat->cond);
+        Statement *trueCase = statement(stat->trueCase);
+        Statement *falseCase = statement(stat->falseCase);
+        result = new IfStatement(cond, trueCase, falseCase);
+        return 0;
+    }
+
+    int32_t visitBreakStatement(BreakStatement *) override
+    {
+        result = new BreakStatement();
+        return 0;
+    }
+
+    int32_t visitContinueStatement(ContinueStatement *) override
+    {
+        result = new ContinueStatement();
+        return 0;
+    }
 
+    int32_t visitReturnStatement(ReturnStatement *stat) override
+    {
+        result = new ReturnStatement(expr(stat->value));
+        return 0;
+    }
+};
+
+/**
+ * Makes a deep copy of the system. The copy shares no mutable state
+ * with the original, so both can be modified and type checked
+ * independently (also concurrently).
+ */
+TimedAutomataSystem::TimedAutomataSystem(const TimedAutomataSystem& ta)
+    : obsTA(ta.obsTA)
 {
-    // TODO
-    // clone ref (functions)
-    // redirect pointers (edges)
-    // clone frame_t - can be problematic
+    SystemCopier copier;
 
-    throw TypeException("TODO");
+    copier.copy(ta.global, global);
+    for (auto& t: ta.templates)
+    {
+        templates.emplace_back();
+        copier.copy(t, templates.back());
+    }
+    for (auto& t: ta.dynamicTemplates)
+    {
+        dynamicTemplates.emplace_back();
+        copier.copy(t, dynamicTemplates.back());
+    }
+    for (auto& i: ta.templateIndex)
+    {
+        templateIndex.emplace(i.first, copier.object(i.second));
+    }
+    for (auto& i: ta.dynamicTemplateIndex)
+    {
+        dynamicTemplateIndex.emplace(i.first, copier.object(i.second));
+    }
+    for (auto t: ta.dynamicTemplatesVec)
+    {
+        dynamicTemplatesVec.push_back(copier.object(t));
+    }
+    for (auto& i: ta.instances)
+    {
+        instances.emplace_back();
+        copier.copy(i, instances.back());
+    }
+    for (auto& i: ta.lscInstances)
+    {
+        lscInstances.emplace_back();
+        copier.copy(i, lscInstances.back());
+    }
+    for (auto& p: ta.processes)
+    {
+        processes.emplace_back();
+        copier.copy(p, processes.back());
+    }
+    for (auto& i: ta.instanceIndex)
+    {
+        instanceIndex.emplace(i.first, copier.object(i.second));
+    }
+    for (auto& i: ta.processIndex)
+    {
+        processIndex.emplace(i.first, copier.object(i.second));
+    }
+    for (auto& p: ta.chanPriorities)
+    {
+        chanPriorities.emplace_back();
+        chanPriorities.back().head = copier.expr(p.head);
+        for (auto& e: p.tail)
+        {
+            chanPriorities.back().tail.emplace_back(e.first, copier.expr(e.second));
+        }
+    }
+    beforeUpdate = copier.expr(ta.beforeUpdate);
+    afterUpdate = copier.expr(ta.afterUpdate);
+    copier.finish();
+
+    hasUrgentTrans = ta.hasUrgentTrans;
+    hasPriorities = ta.hasPriorities;
+    hasStrictInv = ta.hasStrictInv;
+    stopsClock = ta.stopsClock;
+    hasStrictLowControlledGuards = ta.hasStrictLowControlledGuards;
+    hasGuardOnRecvBroadcast = ta.hasGuardOnRecvBroadcast;
+    defaultChanPriority = ta.defaultChanPriority;
+    procPriority = ta.procPriority;
+    syncUsed = ta.syncUsed;
+    modified = ta.modified;
+    queries = ta.queries;
+    location = ta.location;
+
+    positions = std::make_shared<Positions>(*ta.positions);
+    for (auto& e: ta.errors)
+    {
+        errors.emplace_back(positions, e.position, e.message, e.context);
+    }
+    for (auto& w: ta.warnings)
+    {
+        warnings.emplace_back(positions, w.position, w.message, w.context);
+    }
+    errorLimit = ta.errorLimit;
+    typeCheckThreads = ta.typeCheckThreads;
 }
 
 TimedAutomataSystem::~TimedAutomataSystem()
@@ -988,6 +1618,7 @@ template_t &TimedAutomataSystem::addTemplate(const string& name, frame_t params,
     //LSC
     templ.type = typeLSC;
     templ.mode = mode;
+    templateIndex.emplace(name, &templ);
     return templ;
 }
 
@@ -1008,6 +1639,7 @@ template_t& TimedAutomataSystem::addDynamicTemplate(const string& name,
     templ.dynamic = true;
     templ.dynindex = dynamicTemplates.size()-1;
     templ.isDefined = false;
+    dynamicTemplateIndex.emplace(name, &templ);
     return templ;
 }
 
@@ -1023,15 +1655,31 @@ std::vector<template_t*> & TimedAutomataSystem::getDynamicTemplates()
     return dynamicTemplatesVec;
 }
 
+template<class T>
+static T *find(const std::unordered_map<string, T*> &index, const string& name)
+{
+    auto i = index.find(name);
+    return i == index.end() ? NULL : i->second;
+}
+
 template_t* TimedAutomataSystem::getDynamicTemplate(const std::string& name)
 {
-    std::list<template_t>::iterator it;
-    for (it = dynamicTemplates.begin(); it!=dynamicTemplates.end(); ++it) {
-        if (it->uid.getName() == name)
-            return &(*it);
-    }
-    return NULL;
+    return find(dynamicTemplateIndex, name);
+}
+
+template_t *TimedAutomataSystem::findTemplate(const std::string& name) const
+{
+    return find(templateIndex, name);
+}
+
+instance_t *TimedAutomataSystem::findInstance(const std::string& name) const
+{
+    return find(instanceIndex, name);
+}
 
+instance_t *TimedAutomataSystem::findProcess(const std::string& name) const
+{
+    return find(processIndex, name);
 }
 
 instance_t &TimedAutomataSystem::addInstance(
@@ -1055,6 +1703,7 @@ instance_t &TimedAutomataSystem::addInstance(
         instance.mapping[inst.parameters[i]] = arguments[i];
     }
 
+    instanceIndex.emplace(name, &instance);
     return instance;
 }
 
@@ -1079,6 +1728,7 @@ instance_t &TimedAutomataSystem::addLscInstance(
         instance.mapping[inst.parameters[i]] = arguments[i];
     }
 
+    instanceIndex.emplace(name, &instance);
     return instance;
 }
 
@@ -1089,6 +1739,11 @@ void TimedAutomataSystem::removeProcess(instance_t &instance)
     for (itr = processes.begin(); itr != processes.end(); ++itr)
     {
         if (itr->uid == instance.uid) {
+            auto i = processIndex.find(itr->uid.getName());
+            if (i != processIndex.end() && i->second == &*itr)
+            {
+                processIndex.erase(i);
+            }
             processes.erase(itr);
             break;
         }
@@ -1110,6 +1765,7 @@ void TimedAutomataSystem::addProcess(instance_t &instance)
     }
     process.uid = global.frame.addSymbol(
         instance.uid.getName(), type, &process);
+    processIndex.emplace(process.uid.getName(), &process);
 }
 
 void TimedAutomataSystem::addGantt(declarations_t *context, gantt_t& g)
@@ -1181,7 +1837,7 @@ void TimedAutomataSystem::copyVariablesFromTo(template_t* from, template_t* to)
     }
 }
 
-void TimedAutomataSystem::copyFunctionsFromTo(template_t* from, template_t* to) const
+void TimedAutomataSystem::copyFunctionsFromTo(template_t*, template_t*) const
 {
 //TODO to be implemented and to be used in Translator::procBegin (see Translator.cpp)
 }
@@ -1236,33 +1892,28 @@ static void visit(SystemVisitor &visitor, frame_t frame)
     }
 }
 
-void TimedAutomataSystem::accept(SystemVisitor &visitor)
+void TimedAutomataSystem::acceptTemplate(SystemVisitor &visitor, template_t &t)
 {
-    visitor.visitSystemBefore(this);
-    visit(visitor, global.frame);
-
-    auto visit_template = [&visitor](template_t& t) {
-        if (visitor.visitTemplateBefore(t))
-        {
-            visit(visitor, t.frame);
-            for (auto& edge: t.edges)
-                visitor.visitEdge(edge);
-            for (auto& message: t.messages)
-                visitor.visitMessage(message);
-            for (auto& update: t.updates)
-                visitor.visitUpdate(update);
-            for (auto& condition: t.conditions)
-                visitor.visitCondition(condition);
-            visitor.visitTemplateAfter(t);
-        }
-    };
-
-    for (auto& t: templates)
-        visit_template(t);
-
-    for (auto& t: dynamicTemplates)
-        visit_template(t);
+    if (visitor.visitTemplateBefore(t))
+    {
+        visit(visitor, t.frame);
+        for (auto& edge: t.edges)
+            visitor.visitEdge(edge);
+        for (auto& message: t.messages)
+            visitor.visitMessage(message);
+        for (auto& update: t.updates)
+            visitor.visitUpdate(update);
+        for (auto& condition: t.conditions)
+            visitor.visitCondition(condition);
+        visitor.visitTemplateAfter(t);
+    }
+}
 
+/* Visits the processes, instances and the remaining global
+ * declarations, i.e. everything accept() visits after the templates.
+ */
+static void visitSystem(SystemVisitor &visitor, declarations_t &global)
+{
     for (size_t i = 0; i < global.frame.getSize(); i++)
     {
         auto frame = global.frame[i];
@@ -1293,7 +1944,101 @@ void TimedAutomataSystem::accept(SystemVisitor &visitor)
 
     for (auto& gantt: global.ganttChart)
         visitor.visitGanttChart(gantt);
+}
+
+void TimedAutomataSystem::accept(SystemVisitor &visitor)
+{
+    visitor.visitSystemBefore(this);
+    visit(visitor, global.frame);
+
+    for (auto& t: templates)
+        acceptTemplate(visitor, t);
+
+    for (auto& t: dynamicTemplates)
+        acceptTemplate(visitor, t);
+
+    visitSystem(visitor, global);
+    visitor.visitSystemAfter(this);
+}
+
+void TimedAutomataSystem::acceptParallel(SystemVisitor &visitor, size_t threads)
+{
+    vector<template_t*> all;
+    for (auto& t: templates)
+        all.push_back(&t);
+    for (auto& t: dynamicTemplates)
+        all.push_back(&t);
+
+    visitor.visitSystemBefore(this);
+    visit(visitor, global.frame);
+
+    /* The workers are cloned after the global declarations have been
+     * visited, such that they start from the state built from them.
+     */
+    threads = min(threads, all.size());
+    vector<std::unique_ptr<SystemVisitor>> workers;
+    for (size_t i = 0; i < threads && threads > 1; i++)
+    {
+        SystemVisitor *worker = visitor.clone();
+        if (worker == NULL)
+        {
+            break;
+        }
+        workers.emplace_back(worker);
+    }
+    if (workers.size() < 2)
+    {
+        for (auto t: all)
+        {
+            acceptTemplate(visitor, *t);
+        }
+        visitSystem(visitor, global);
+        visitor.visitSystemAfter(this);
+        return;
+    }
+
+    /* Worker i visits templates [i * n / k, (i + 1) * n / k), so that
+     * reducing the workers in order preserves the template order.
+     */
+    size_t n = all.size(), k = workers.size();
+    vector<std::exception_ptr> exceptions(k);
+    auto work = [this, &all, &workers, &exceptions, n, k](size_t i) {
+        try
+        {
+            for (size_t j = i * n / k; j < (i + 1) * n / k; j++)
+            {
+                acceptTemplate(*workers[i], *all[j]);
+            }
+        }
+        catch (...)
+        {
+            exceptions[i] = std::current_exception();
+        }
+    };
 
+    vector<std::thread> pool;
+    for (size_t i = 1; i < k; i++)
+    {
+        pool.emplace_back(work, i);
+    }
+    work(0);
+    for (auto& thread: pool)
+    {
+        thread.join();
+    }
+    for (auto& exception: exceptions)
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+    for (auto& worker: workers)
+    {
+        visitor.reduce(*worker);
+    }
+
+    visitSystem(visitor, global);
     visitor.visitSystemAfter(this);
 }
 
@@ -1350,8 +2095,14 @@ void TimedAutomataSystem::setProcPriority(const char* name, int priority)
 
 int TimedAutomataSystem::getProcPriority(const char* name) const
 {
-    assert(procPriority.find(name) != procPriority.end());
-    return procPriority.find(name)->second;
+    return getProcPriority(std::string(name));
+}
+
+int TimedAutomataSystem::getProcPriority(const std::string& name) const
+{
+    auto i = procPriority.find(name);
+    assert(i != procPriority.end());
+    return i->second;
 }
 
 bool TimedAutomataSystem::hasPriorityDeclaration() const
@@ -1392,28 +2143,40 @@ void TimedAutomataSystem::recordStrictLowerBoundOnControllableEdges()
 void TimedAutomataSystem::addPosition(
     uint32_t position, uint32_t offset, uint32_t line, const std::string& path)
 {
-    positions.add(position, offset, line, path);
+    positions->add(position, offset, line, path);
+    if (statistics)
+    {
+        statistics->add(Statistics::POSITIONS,
+                        sizeof(Positions::line_t) + path.size());
+    }
 }
 
 const Positions::line_t &TimedAutomataSystem::findPosition(uint32_t position) const
 {
-    return positions.find(position);
+    return positions->find(position);
 }
 
 void TimedAutomataSystem::addError(position_t position, const std::string& msg,
                                    const std::string& context)
 {
-    errors.emplace_back(positions.find(position.start),
-                        positions.find(position.end),
-                        position, msg, context);
+    if (!isErrorLimitReached())
+    {
+        errors.emplace_back(positions, position, msg, context);
+        if (statistics)
+        {
+            statistics->add(Statistics::ERRORS, sizeof(error_t));
+        }
+    }
 }
 
 void TimedAutomataSystem::addWarning(position_t position, const std::string& msg,
                                      const std::string& context)
 {
-    warnings.emplace_back(positions.find(position.start),
-                          positions.find(position.end),
-                          position, msg, context);
+    warnings.emplace_back(positions, position, msg, context);
+    if (statistics)
+    {
+        statistics->add(Statistics::WARNINGS, sizeof(error_t));
+    }
 }
 
 // Returns the errors
@@ -1448,6 +2211,48 @@ void TimedAutomataSystem::clearWarnings()
     warnings.clear();
 }
 
+void TimedAutomataSystem::setErrorLimit(size_t limit)
+{
+    errorLimit = limit;
+}
+
+size_t TimedAutomataSystem::getErrorLimit() const
+{
+    return errorLimit;
+}
+
+void TimedAutomataSystem::setTypeCheckThreads(size_t threads)
+{
+    typeCheckThreads = std::max<size_t>(threads, 1);
+}
+
+size_t TimedAutomataSystem::getTypeCheckThreads() const
+{
+    return typeCheckThreads;
+}
+
+bool TimedAutomataSystem::isErrorLimitReached() const
+{
+    return errorLimit > 0 && errors.size() >= errorLimit;
+}
+
+void TimedAutomataSystem::setStatisticsEnabled(bool enabled)
+{
+    if (enabled)
+    {
+        statistics = std::make_shared<Statistics>();
+    }
+    else
+    {
+        statistics.reset();
+    }
+}
+
+Statistics *TimedAutomataSystem::getStatistics() const
+{
+    return statistics.get();
+}
+
 bool TimedAutomataSystem::isModified() const
 {
     return modified;
@@ -224,6 +224,10 @@ void SystemBuilder::procBegin(const char* name, const bool isTA,
 
 void SystemBuilder::procEnd() // 1 ProcBody
 {
+    if (currentTemplate)
+    {
+        currentTemplate->buildEdgeIndex();
+    }
     currentTemplate = NULL;
     popFrame();
 }
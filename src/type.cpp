@@ -20,9 +20,11 @@
 */
 
 #include <boost/format.hpp>
+#include <bitset>
 
 #include "utap/type.h"
 #include "utap/expression.h"
+#include "utap/statistics.h"
 
 using std::string;
 using std::vector;
@@ -42,6 +44,22 @@ struct type_t::type_data
     position_t position;        // Position in the input file
     expression_t expr;          //
     std::vector<child_t> children;
+
+    /* Traits computed by computeTraits() once the children are set.
+     */
+    enum flag_t {
+        INTEGRAL = 1 << 0,
+        INVARIANT = 1 << 1,
+        GUARD = 1 << 2,
+        CONSTRAINT = 1 << 3,
+        FORMULA = 1 << 4,
+        CONSTANT = 1 << 5,
+        NONCONSTANT = 1 << 6
+    };
+    std::bitset<256> kinds;     // Kinds for which is() holds
+    uint32_t flags;             // Combination of flag_t
+    type_t stripped;            // Result of strip(), null if *this
+    type_t strippedArray;       // Result of stripArray(), null if *this
 };
 
 type_t::type_t(kind_t kind, const position_t &pos, size_t size)
@@ -50,6 +68,99 @@ type_t::type_t(kind_t kind, const position_t &pos, size_t size)
     data->kind = kind;
     data->position = pos;
     data->children.resize(size);
+    assert(kind < data->kinds.size());
+    computeTraits();
+    Statistics::record(Statistics::TYPES,
+                       sizeof(type_data) + size * sizeof(child_t));
+}
+
+/**
+ * Computes the cached traits from the kind and the children. Must be
+ * called by every factory once the children have been set; types are
+ * immutable afterwards.
+ */
+void type_t::computeTraits()
+{
+    type_data &d = *data;
+    const type_t child = size() > 0 ? get(0) : type_t();
+    const bool wrapper = size() > 0 &&
+        (isPrefix() || d.kind == RANGE || d.kind == REF || d.kind == LABEL);
+
+    d.kinds.reset();
+    d.kinds.set(d.kind);
+    if (wrapper && d.kind != PROCESSVAR && d.kind != DOUBLEINVGUARD)
+    {
+        if (child.data)
+        {
+            d.kinds |= child.data->kinds;
+        }
+        else
+        {
+            d.kinds.set(UNKNOWN);
+        }
+    }
+
+    d.stripped = wrapper ? child.strip() : type_t();
+    const type_t base = strip();
+    d.strippedArray = base.getKind() == ARRAY
+        ? base.get(0).stripArray() : d.stripped;
+
+    d.flags = 0;
+    if (d.kinds[Constants::INT] || d.kinds[Constants::BOOL] || d.kinds[PROCESSVAR])
+    {
+        d.flags |= type_data::INTEGRAL;
+    }
+    if (d.kinds[INVARIANT] || (d.flags & type_data::INTEGRAL))
+    {
+        d.flags |= type_data::INVARIANT;
+    }
+    if (d.kinds[GUARD] || (d.flags & type_data::INVARIANT))
+    {
+        d.flags |= type_data::GUARD;
+    }
+    if (d.kinds[CONSTRAINT] || (d.flags & type_data::GUARD))
+    {
+        d.flags |= type_data::CONSTRAINT;
+    }
+    if (d.kinds[FORMULA] || (d.flags & type_data::CONSTRAINT))
+    {
+        d.flags |= type_data::FORMULA;
+    }
+
+    switch (d.kind)
+    {
+    case FUNCTION:
+    case PROCESS:
+    case INSTANCE:
+    case LSCINSTANCE:
+        break;
+    case CONSTANT:
+        d.flags |= type_data::CONSTANT;
+        break;
+    case RECORD:
+    {
+        bool constant = true;
+        bool nonConstant = true;
+        for (size_t i = 0; i < size(); i++)
+        {
+            constant &= get(i).data && get(i).isConstant();
+            nonConstant &= !get(i).data || get(i).isNonConstant();
+        }
+        d.flags |= (constant ? type_data::CONSTANT : 0)
+            | (nonConstant ? type_data::NONCONSTANT : 0);
+        break;
+    }
+    default:
+        if (size() == 0 || !child.data)
+        {
+            d.flags |= type_data::NONCONSTANT;
+        }
+        else
+        {
+            d.flags |= child.data->flags
+                & (type_data::CONSTANT | type_data::NONCONSTANT);
+        }
+    }
 }
 
 type_t::type_t(const type_t &type)
@@ -175,19 +286,11 @@ bool type_t::unknown() const
 
 bool type_t::is(kind_t kind) const
 {
-    if (getKind () == Constants::PROCESSVAR) 
-    {
-        return kind == Constants::PROCESSVAR;
-    }
-    if (getKind () == Constants::DOUBLEINVGUARD) 
+    if (data == NULL)
     {
-        return kind == Constants::DOUBLEINVGUARD;
+        return kind == UNKNOWN;
     }
-    return (getKind() == kind)
-        || (isPrefix() && get(0).is(kind))
-        || (getKind() == RANGE && get(0).is(kind))
-        || (getKind() == REF && get(0).is(kind))
-        || (getKind() == LABEL && get(0).is(kind));
+    return kind < data->kinds.size() && data->kinds[kind];
 }
 
 type_t type_t::getSub() const
@@ -284,24 +387,20 @@ expression_t type_t::getExpression() const
 
 type_t type_t::strip() const
 {
-    if (isPrefix() || getKind() == RANGE || getKind() == REF || getKind() == LABEL)
-    {
-        return get(0).strip();
-    }
-    else
+    if (data == NULL || data->stripped.data == NULL)
     {
         return *this;
     }
+    return data->stripped;
 }
 
 type_t type_t::stripArray() const
 {
-    type_t type = strip();
-    while (type.getKind() == ARRAY)
+    if (data == NULL || data->strippedArray.data == NULL)
     {
-        type = type.get(0).strip();
+        return *this;
     }
-    return type;
+    return data->strippedArray;
 }
 
 type_t type_t::rename(const std::string& from, const std::string& to) const
@@ -317,6 +416,7 @@ type_t type_t::rename(const std::string& from, const std::string& to) const
     {
         type.data->children[0].label = to;
     }
+    type.computeTraits();
     return type;
 }
 
@@ -332,6 +432,45 @@ type_t type_t::subst(symbol_t symbol, expression_t expr) const
     {
         type.data->expr = data->expr.subst(symbol, expr);
     }
+    type.computeTraits();
+    return type;
+}
+
+type_t type_t::rebuild(
+    const std::function<type_t(type_t)> &children,
+    const std::function<expression_t(expression_t)> &expressions) const
+{
+    if (data == NULL)
+    {
+        return *this;
+    }
+
+    bool changed = false;
+    vector<type_t> types(size());
+    for (size_t i = 0; i < size(); i++)
+    {
+        types[i] = children(get(i));
+        changed |= types[i] != get(i);
+    }
+    expression_t expr = data->expr;
+    if (!expr.empty())
+    {
+        expr = expressions(expr);
+        changed |= !(expr == data->expr);
+    }
+    if (!changed)
+    {
+        return *this;
+    }
+
+    type_t type(data->kind, data->position, size());
+    type.data->expr = expr;
+    for (size_t i = 0; i < size(); i++)
+    {
+        type.data->children[i].child = types[i];
+        type.data->children[i].label = getLabel(i);
+    }
+    type.computeTraits();
     return type;
 }
 
@@ -342,17 +481,17 @@ position_t type_t::getPosition() const
 
 bool type_t::isIntegral() const
 {
-    return is(Constants::INT) || is(Constants::BOOL) || is(PROCESSVAR);
+    return data && (data->flags & type_data::INTEGRAL);
 }
 
 bool type_t::isInvariant() const
 {
-    return is(INVARIANT) || isIntegral();
+    return data && (data->flags & type_data::INVARIANT);
 }
 
 bool type_t::isGuard() const
 {
-    return is(GUARD) || isInvariant();
+    return data && (data->flags & type_data::GUARD);
 }
 
 #ifdef ENABLE_PROB
@@ -364,62 +503,24 @@ bool type_t::isProbability() const
 
 bool type_t::isConstraint() const
 {
-    return is(CONSTRAINT) || isGuard();
+    return data && (data->flags & type_data::CONSTRAINT);
 }
 
 bool type_t::isFormula() const
 {
-    return is(FORMULA) || isConstraint();
+    return data && (data->flags & type_data::FORMULA);
 }
 
 bool type_t::isConstant() const
 {
-    switch (getKind())
-    {
-    case FUNCTION:
-    case PROCESS:
-    case INSTANCE:
-    case LSCINSTANCE:
-        return false;
-    case CONSTANT:
-        return true;
-    case RECORD:
-        for (size_t i = 0; i < size(); i++)
-        {
-            if (!get(i).isConstant())
-            {
-                return false;
-            }
-        }
-        return true;
-    default:
-        return size() > 0 && get(0).isConstant();
-    }
+    assert(data);
+    return data->flags & type_data::CONSTANT;
 }
 
 bool type_t::isNonConstant() const
 {
-    switch (getKind())
-    {
-    case FUNCTION:
-    case PROCESS:
-    case INSTANCE:
-    case LSCINSTANCE:
-        return false;
-    case CONSTANT:
-        return false;
-    case RECORD:
-        for (size_t i = 0; i < size(); i++)
-        {
-            if (!get(i).isNonConstant())
-            {
-                return false;
-            }
-        }
-        return true;
-    default:
-        return size() == 0 || get(0).isNonConstant();
-    }
+    assert(data);
+    return data->flags & type_data::NONCONSTANT;
 }
 
 type_t type_t::createRange(type_t type, expression_t lower, expression_t upper,
@@ -431,6 +532,7 @@ type_t type_t::createRange(type_t type, expression_t lower, expression_t upper,
     t.data->children[2].child = type_t(UNKNOWN, pos, 0);
     t[1].data->expr = lower;
     t[2].data->expr = upper;
+    t.computeTraits();
     return t;
 }
         
@@ -445,6 +547,7 @@ type_t type_t::createRecord(const vector<type_t> &types,
         type.data->children[i].child = types[i];
         type.data->children[i].label = labels[i];
     }
+    type.computeTraits();
     return type;
 }
 
@@ -461,6 +564,7 @@ type_t type_t::createFunction(type_t ret,
         type.data->children[i + 1].child = parameters[i];
         type.data->children[i + 1].label = labels[i];
     }
+    type.computeTraits();
     return type;
 }
 
@@ -469,6 +573,7 @@ type_t type_t::createArray(type_t sub, type_t size, position_t pos)
     type_t type(ARRAY, pos, 2);
     type.data->children[0].child = sub;
     type.data->children[1].child = size;
+    type.computeTraits();
     return type;
 }
 
@@ -477,6 +582,7 @@ type_t type_t::createTypeDef(const std::string& label, type_t type, position_t p
     type_t t(TYPEDEF, pos, 1);
     t.data->children[0].label = label;
     t.data->children[0].child = type;
+    t.computeTraits();
     return t;
 }
 
@@ -488,6 +594,7 @@ type_t type_t::createInstance(frame_t parameters, position_t pos)
         type.data->children[i].child = parameters[i].getType();
         type.data->children[i].label = parameters[i].getName();
     }
+    type.computeTraits();
     return type;
 }
 
@@ -499,6 +606,7 @@ type_t type_t::createLscInstance(frame_t parameters, position_t pos)
         type.data->children[i].child = parameters[i].getType();
         type.data->children[i].label = parameters[i].getName();
     }
+    type.computeTraits();
     return type;
 }
 
@@ -510,6 +618,7 @@ type_t type_t::createProcess(frame_t frame, position_t pos)
         type.data->children[i].child = frame[i].getType();
         type.data->children[i].label = frame[i].getName();
     }
+    type.computeTraits();
     return type;
 }
 
@@ -521,6 +630,7 @@ type_t type_t::createProcessSet(type_t instance, position_t pos)
         type.data->children[i].child = instance[i];
         type.data->children[i].label = instance.getLabel(i);
     }
+    type.computeTraits();
     return type;
 }
 
@@ -533,6 +643,7 @@ type_t type_t::createPrefix(kind_t kind, position_t pos) const
 {
     type_t type(kind, pos, 1);
     type.data->children[0].child = *this;
+    type.computeTraits();
     return type;
 }
 
@@ -541,6 +652,7 @@ type_t type_t::createLabel(const string& label, position_t pos) const
     type_t type(LABEL, pos, 1);
     type.data->children[0].child = *this;
     type.data->children[0].label = label;
+    type.computeTraits();
     return type;
 }
 
@@ -876,13 +988,17 @@ string type_t::toDeclarationString() const
     if (range)
     {
         str += get(0).toDeclarationString();
-        if (getRange().first.getValue() != -32768 ||
-            getRange().second.getValue() != 32767)
+        // The bounds need not be literals, e.g. int[-100,100]
+        std::pair<expression_t, expression_t> bounds = getRange();
+        if (bounds.first.getKind() != CONSTANT ||
+            bounds.second.getKind() != CONSTANT ||
+            bounds.first.getValue() != -32768 ||
+            bounds.second.getValue() != 32767)
         {
             str += "[";
-            str += getRange().first.toString();
+            str += bounds.first.toString();
             str += ",";
-            str += getRange().second.toString();
+            str += bounds.second.toString();
             str += "]";
             str += get(1).toDeclarationString();
         }
@@ -27,8 +27,11 @@
 #include <list>
 #include <stdexcept>
 #include <cmath>
+#include <limits>
 #include <cstdio>
 #include <cassert>
+#include <atomic>
+#include <thread>
 #include <boost/tuple/tuple.hpp>
 
 using std::exception;
@@ -288,6 +291,18 @@ void CompileTimeComputableValues::visitInstance(instance_t &temp)
     }
 }
 
+SystemVisitor *CompileTimeComputableValues::clone() const
+{
+    return new CompileTimeComputableValues(*this);
+}
+
+void CompileTimeComputableValues::reduce(SystemVisitor &worker)
+{
+    const CompileTimeComputableValues &values =
+        static_cast<CompileTimeComputableValues&>(worker);
+    variables.insert(values.variables.begin(), values.variables.end());
+}
+
 bool CompileTimeComputableValues::contains(symbol_t symbol) const
 {
     return (variables.find(symbol) != variables.end());
@@ -390,25 +405,202 @@ void RateDecomposer::decompose(expression_t expr, bool inforall)
 
 ///////////////////////////////////////////////////////////////////////////
 
+/** Source of type checking epochs; 0 means unchecked. */
+static std::atomic<uint32_t> epochs{0};
+
 TypeChecker::TypeChecker(
     TimedAutomataSystem *_system, bool refinement)
-    : system{_system}, refinementWarnings{refinement}
+    : system{_system}, refinementWarnings{refinement}, epoch{++epochs}
 {
     system->accept(compileTimeComputableValues);
     checkExpression(system->getBeforeUpdate());
     checkExpression(system->getAfterUpdate());
 }
 
+/**
+ * Creates a worker for parallel type checking. Workers share the
+ * compile time computable values of their parent and must hold \a
+ * lock while type checking expressions inside types, as these may
+ * be shared between templates (e.g. through global type
+ * definitions).
+ */
+TypeChecker::TypeChecker(const TypeChecker &parent, std::mutex &lock)
+    : system{parent.system},
+      compileTimeComputableValues{parent.compileTimeComputableValues},
+      refinementWarnings{parent.refinementWarnings},
+      typeLock{&lock},
+      epoch{parent.epoch}
+{
+}
+
+void TypeChecker::setThreads(size_t n)
+{
+    threads = std::max<size_t>(n, 1);
+}
+
 template<class T>
 void TypeChecker::handleWarning(const T& expr, const std::string& msg)
 {
-    system->addWarning(expr.getPosition(), msg, "(typechecking)");
+    if (task)
+    {
+        task->diagnostics.push_back({true, expr.getPosition(), msg, expression_t()});
+    }
+    else
+    {
+        system->addWarning(expr.getPosition(), msg, "(typechecking)");
+    }
 }
 
 template<class T>
 void TypeChecker::handleError(const T& expr, const std::string& msg)
 {
-    system->addError(expr.getPosition(), msg, "(typechecking)");
+    if (task)
+    {
+        task->diagnostics.push_back({false, expr.getPosition(), msg, expression_t()});
+        task->errors++;
+    }
+    else
+    {
+        system->addError(expr.getPosition(), msg, "(typechecking)");
+    }
+}
+
+/**
+ * Returns true if the error limit of the system has been reached,
+ * counting the errors buffered by the current task. Checking stops
+ * early when this happens.
+ */
+bool TypeChecker::isErrorLimitReached() const
+{
+    size_t limit = system->getErrorLimit();
+    return limit > 0
+        && system->getErrors().size() + (task ? task->errors : 0) >= limit;
+}
+
+void TypeChecker::recordFact(fact_t fact)
+{
+    if (task)
+    {
+        task->facts |= fact;
+        return;
+    }
+    switch (fact)
+    {
+    case STRICT_INVARIANT:
+        system->recordStrictInvariant();
+        break;
+    case STOP_WATCH:
+        system->recordStopWatch();
+        break;
+    case STRICT_LOWER_BOUND_ON_CONTROLLABLE_EDGES:
+        system->recordStrictLowerBoundOnControllableEdges();
+        break;
+    case URGENT_TRANSITION:
+        system->setUrgentTransition();
+        break;
+    case CLOCK_GUARD_RECV_BROADCAST:
+        system->clockGuardRecvBroadcast();
+        break;
+    }
+}
+
+void TypeChecker::addTask(bool parallel, std::function<void(TypeChecker &)> run)
+{
+    tasks.emplace_back();
+    tasks.back().parallel = parallel;
+    tasks.back().run = std::move(run);
+}
+
+/**
+ * Runs the queued tasks. Parallel tasks are distributed over a pool
+ * of workers (the calling thread being one of them). Afterwards the
+ * tasks are visited in source order: the buffered diagnostics and
+ * facts of parallel tasks are passed on to the system, and serial
+ * tasks are run on this checker.
+ */
+void TypeChecker::runTasks()
+{
+    std::mutex lock;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> reused{0};
+    Statistics *statistics = Statistics::current();
+    auto work = [this, &lock, &next, &reused, statistics]() {
+        Statistics::Scope scope(statistics);
+        TypeChecker worker(*this, lock);
+        size_t i;
+        while ((i = next++) < tasks.size())
+        {
+            task_t &t = tasks[i];
+            if (!t.parallel)
+            {
+                continue;
+            }
+            worker.task = &t;
+            try
+            {
+                t.run(worker);
+            }
+            catch (...)
+            {
+                t.exception = std::current_exception();
+                worker.temp = nullptr;
+                worker.function = nullptr;
+            }
+            worker.task = nullptr;
+        }
+        reused += worker.skipped;
+    };
+
+    size_t parallel = std::count_if(tasks.begin(), tasks.end(),
+                                    [](const task_t &t) { return t.parallel; });
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < std::min(threads, parallel); i++)
+    {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread: pool)
+    {
+        thread.join();
+    }
+    skipped += reused;
+
+    std::vector<task_t> done;
+    done.swap(tasks);
+    for (auto& t: done)
+    {
+        if (!t.parallel)
+        {
+            t.run(*this);
+            continue;
+        }
+        if (t.exception)
+        {
+            std::rethrow_exception(t.exception);
+        }
+        for (auto& d: t.diagnostics)
+        {
+            if (!d.sync.empty())
+            {
+                checkSyncUsage(d.sync);
+            }
+            else if (d.warning)
+            {
+                system->addWarning(d.position, d.message, "(typechecking)");
+            }
+            else
+            {
+                system->addError(d.position, d.message, "(typechecking)");
+            }
+        }
+        for (uint32_t fact = STRICT_INVARIANT; fact <= CLOCK_GUARD_RECV_BROADCAST; fact <<= 1)
+        {
+            if (t.facts & fact)
+            {
+                recordFact(static_cast<fact_t>(fact));
+            }
+        }
+    }
 }
 
 /**
@@ -433,6 +625,227 @@ void TypeChecker::checkIgnoredValue(expression_t expr)
     }
 }
 
+/** Stores \a result in \a value if it is representable as int32_t. */
+static bool narrow(int64_t result, int32_t &value)
+{
+    if (result < std::numeric_limits<int32_t>::min()
+        || result > std::numeric_limits<int32_t>::max())
+    {
+        return false;
+    }
+    value = result;
+    return true;
+}
+
+/**
+ * Returns the variable declared by \a symbol, or NULL if the symbol
+ * is not a variable, e.g. a parameter, function or type name.
+ */
+static variable_t *getVariable(symbol_t symbol)
+{
+    type_t type = symbol.getType();
+    if (type.getKind() == TYPEDEF || type.isFunction()
+        || !(type.is(Constants::INT) || type.is(Constants::BOOL)
+             || type.is(SCALAR)))
+    {
+        return NULL;
+    }
+    return static_cast<variable_t*>(symbol.getData());
+}
+
+/**
+ * Evaluates an integer expression built from constants, constant
+ * variables with an initialiser and integer operators. Returns false
+ * if the value is not known before instantiation, e.g. because it
+ * depends on a template parameter, or if it overflows int32_t.
+ *
+ * Constants whose value was cached by resolveBounds() are not
+ * evaluated again. If \a resolved is true, only such constants are
+ * accepted, and both branches of an inline if must be evaluable, so
+ * the expression is known to be compile time computable.
+ */
+static bool evaluate(expression_t expr, int32_t &value, bool resolved = false)
+{
+    int32_t a, b;
+    switch (expr.getKind())
+    {
+    case CONSTANT:
+        if (!expr.getType().isIntegral())
+        {
+            return false;
+        }
+        value = expr.getValue();
+        return true;
+
+    case IDENTIFIER:
+    {
+        symbol_t symbol = expr.getSymbol();
+        type_t type = symbol.getType();
+        variable_t *var = getVariable(symbol);
+        if (var == NULL || !type.isIntegral() || !type.isConstant()
+            || type.isArray())
+        {
+            return false;
+        }
+        range_t range = symbol.getRange();
+        if (!type.isRange() && !range.isEmpty() && range.lower == range.upper)
+        {
+            value = range.lower;
+            return true;
+        }
+        return !resolved && !var->expr.empty() && evaluate(var->expr, value);
+    }
+
+    case UNARY_MINUS:
+        if (!evaluate(expr[0], a, resolved))
+        {
+            return false;
+        }
+        return narrow(-(int64_t)a, value);
+
+    case NOT:
+        if (!evaluate(expr[0], a, resolved))
+        {
+            return false;
+        }
+        value = !a;
+        return true;
+
+    case INLINEIF:
+        if (!evaluate(expr[0], a, resolved))
+        {
+            return false;
+        }
+        if (resolved && !evaluate(a ? expr[2] : expr[1], b, resolved))
+        {
+            return false;
+        }
+        return evaluate(a ? expr[1] : expr[2], value, resolved);
+
+    case PLUS: case MINUS: case MULT: case DIV: case MOD:
+    case BIT_AND: case BIT_OR: case BIT_XOR: case BIT_LSHIFT: case BIT_RSHIFT:
+    case AND: case OR: case MIN: case MAX:
+    case LT: case LE: case EQ: case NEQ: case GE: case GT:
+        if (!evaluate(expr[0], a, resolved) || !evaluate(expr[1], b, resolved))
+        {
+            return false;
+        }
+        switch (expr.getKind())
+        {
+        case PLUS:  return narrow((int64_t)a + b, value);
+        case MINUS: return narrow((int64_t)a - b, value);
+        case MULT:  return narrow((int64_t)a * b, value);
+        case DIV:
+        case MOD:
+            // INT_MIN / -1 overflows, and so does INT_MIN % -1 in
+            // hardware, hence both are left to run time
+            if (b == 0 || (b == -1 && a == std::numeric_limits<int32_t>::min()))
+            {
+                return false;
+            }
+            value = expr.getKind() == DIV ? a / b : a % b;
+            break;
+        case BIT_AND: value = a & b; break;
+        case BIT_OR:  value = a | b; break;
+        case BIT_XOR: value = a ^ b; break;
+        case BIT_LSHIFT:
+        case BIT_RSHIFT:
+            if (b < 0 || b > 31)
+            {
+                return false;
+            }
+            if (expr.getKind() == BIT_LSHIFT)
+            {
+                return narrow((int64_t)a * ((int64_t)1 << b), value);
+            }
+            value = a >> b;
+            break;
+        case AND: value = a && b; break;
+        case OR:  value = a || b; break;
+        case MIN: value = std::min(a, b); break;
+        case MAX: value = std::max(a, b); break;
+        case LT:  value = a < b; break;
+        case LE:  value = a <= b; break;
+        case EQ:  value = a == b; break;
+        case NEQ: value = a != b; break;
+        case GE:  value = a >= b; break;
+        case GT:  value = a > b; break;
+        default:
+            return false;
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/** Evaluates the bounds of a RANGE type. */
+static bool evaluate(type_t type, range_t &range)
+{
+    int32_t lower, upper;
+    expression_t l, u;
+    tie(l, u) = type.getRange();
+    if (!evaluate(l, lower) || !evaluate(u, upper))
+    {
+        return false;
+    }
+    range = range_t(lower, upper);
+    return true;
+}
+
+/**
+ * Stores the concrete value range and number of elements of \a
+ * symbol in the symbol (see symbol_t::getRange()). Bounds which
+ * depend on template parameters are left unresolved. The range of a
+ * compile time computable integer constant is its value, which
+ * evaluate() and isCompileTimeComputable() then use without
+ * evaluating the initialiser again.
+ */
+void TypeChecker::resolveBounds(symbol_t symbol)
+{
+    type_t type = symbol.getType();
+    if (type.getKind() == TYPEDEF)
+    {
+        type = type[0];
+    }
+
+    uint64_t elements = 1;
+    while (type.isArray())
+    {
+        range_t size;
+        type_t index = type.getArraySize();
+        if (index.isRange() && evaluate(index, size) && !size.isEmpty()
+            && elements * size.size() <= UINT32_MAX)
+        {
+            elements *= size.size();
+        }
+        else
+        {
+            elements = 0;
+        }
+        type = type.getSub();
+    }
+
+    range_t range;
+    int32_t value;
+    if (type.isRange())
+    {
+        evaluate(type, range);
+    }
+    else if (!type.isArray() && type.isConstant() && type.isIntegral()
+             && compileTimeComputableValues.contains(symbol)
+             && evaluate(expression_t::createIdentifier(symbol), value))
+    {
+        range = range_t(value);
+    }
+    else if (type.isBoolean())
+    {
+        range = range_t(0, 1);
+    }
+    symbol.setBounds(range, elements);
+}
+
 bool TypeChecker::isCompileTimeComputable(expression_t expr) const
 {
     /* An expression is compile time computable if all identifers it
@@ -444,6 +857,12 @@ bool TypeChecker::isCompileTimeComputable(expression_t expr) const
      * would increase the class of models we accept while also getting
      * rid of the compileTimeComputableValues object.
      */
+    int32_t value;
+    if (evaluate(expr, value, true))
+    {
+        return true;
+    }
+
     set<symbol_t> reads;
     expr.collectPossibleReads(reads, true);
     for (set<symbol_t>::iterator i = reads.begin(); i != reads.end(); i++)
@@ -554,10 +973,16 @@ void TypeChecker::checkType(type_t type, bool initialisable, bool inStruct)
         break;
 
     case RANGE:
+    {
         if (!type.isInteger() && !type.isScalar())
         {
             handleError(type, "$Range_over_this_type_not_allowed");
         }
+        std::unique_lock<std::mutex> guard;
+        if (typeLock)
+        {
+            guard = std::unique_lock<std::mutex>(*typeLock);
+        }
         tie(l, u) = type.getRange();
         if (checkExpression(l))
         {
@@ -582,6 +1007,7 @@ void TypeChecker::checkType(type_t type, bool initialisable, bool inStruct)
             }
         }
         break;
+    }
 
     case ARRAY:
         size = type.getArraySize();
@@ -620,8 +1046,19 @@ void TypeChecker::checkType(type_t type, bool initialisable, bool inStruct)
     }
 }
 
+void TypeChecker::visitSystemBefore(TimedAutomataSystem *)
+{
+    collecting = threads > 1;
+}
+
 void TypeChecker::visitSystemAfter(TimedAutomataSystem* sys)
 {
+    if (collecting)
+    {
+        collecting = false;
+        runTasks();
+    }
+
     const std::list<chan_priority_t>& list = sys->getChanPriorities();
     std::list<chan_priority_t>::const_iterator i;
     for (i = list.begin(); i != list.end(); i++)
@@ -713,6 +1150,12 @@ void TypeChecker::visitHybridClock(expression_t e)
 
 void TypeChecker::visitIODecl(iodecl_t &iodecl)
 {
+    if (collecting)
+    {
+        addTask(false, [&iodecl](TypeChecker &c) { c.visitIODecl(iodecl); });
+        return;
+    }
+
     for(vector<expression_t>::iterator i = iodecl.param.begin();
         i != iodecl.param.end(); ++i)
     {
@@ -837,6 +1280,16 @@ void TypeChecker::visitIODecl(iodecl_t &iodecl)
 
 void TypeChecker::visitProcess(instance_t &process)
 {
+    if (collecting)
+    {
+        addTask(true, [&process](TypeChecker &c) { c.visitProcess(process); });
+        return;
+    }
+    if (isErrorLimitReached())
+    {
+        return;
+    }
+
     for (size_t i = 0; i < process.unbound; i++)
     {
         /* Unbound parameters of processes must be either scalars or
@@ -863,8 +1316,13 @@ void TypeChecker::visitProcess(instance_t &process)
 void TypeChecker::visitVariable(variable_t &variable)
 {
     SystemVisitor::visitVariable(variable);
+    if (isErrorLimitReached())
+    {
+        return;
+    }
 
     checkType(variable.uid.getType());
+    resolveBounds(variable.uid);
     if (variable.expr.isDynamic() || variable.expr.hasDynamicSub ())
     {
         handleError (variable.expr,"Dynamic constructions cannot be used as initialisers");
@@ -886,9 +1344,18 @@ void TypeChecker::visitVariable(variable_t &variable)
     }
 }
 
+void TypeChecker::visitTypeDef(symbol_t symbol)
+{
+    resolveBounds(symbol);
+}
+
 void TypeChecker::visitState(state_t &state)
 {
     SystemVisitor::visitState(state);
+    if (isErrorLimitReached())
+    {
+        return;
+    }
 
     if (!state.invariant.empty())
     {
@@ -917,11 +1384,11 @@ void TypeChecker::visitState(state_t &state)
                 }
                 if (decomposer.hasClockRates)
                 {
-                    system->recordStopWatch();
+                    recordFact(STOP_WATCH);
                 }
                 if (decomposer.hasStrictInvariant)
                 {
-                    system->recordStrictInvariant();
+                    recordFact(STRICT_INVARIANT);
 #if ENABLE_TIGA
                     handleWarning(state.invariant, "$Strict_invariant");
 #endif
@@ -943,9 +1410,66 @@ void TypeChecker::visitState(state_t &state)
     }
 }
 
+/**
+ * Checks that the synchronisation \a sync is consistent with the
+ * synchronisations seen so far, i.e. that IO and CSP synchronisations
+ * are not mixed.
+ */
+void TypeChecker::checkSyncUsage(expression_t sync)
+{
+    switch(syncUsed)
+    {
+    case sync_use_t::unused:
+        switch(sync.getSync())
+        {
+        case SYNC_BANG:
+        case SYNC_QUE:
+            syncUsed = sync_use_t::io;
+            break;
+        case SYNC_CSP:
+            syncUsed = sync_use_t::csp;
+            break;
+        }
+        break;
+    case sync_use_t::io:
+        switch(sync.getSync())
+        {
+        case SYNC_BANG:
+        case SYNC_QUE:
+            // ok
+            break;
+        case SYNC_CSP:
+            syncError = true;
+            handleError(sync, "$Assumed_IO_but_found_CSP_synchronization");
+            break;
+        }
+        break;
+    case sync_use_t::csp:
+        switch(sync.getSync())
+        {
+        case SYNC_BANG:
+        case SYNC_QUE:
+            syncError = true;
+            handleError(sync, "$Assumed_CSP_but_found_IO_synchronization");
+            break;
+        case SYNC_CSP:
+            // ok
+            break;
+        }
+        break;
+    default:
+    // nothing
+    ;
+    }
+}
+
 void TypeChecker::visitEdge(edge_t &edge)
 {
     SystemVisitor::visitEdge(edge);
+    if (isErrorLimitReached())
+    {
+        return;
+    }
 
     // select
     frame_t select = edge.select;
@@ -975,7 +1499,7 @@ void TypeChecker::visitEdge(edge_t &edge)
             {
                 if (edge.control)
                 {
-                    system->recordStrictLowerBoundOnControllableEdges();
+                    recordFact(STRICT_LOWER_BOUND_ON_CONTROLLABLE_EDGES);
                 }
                 strictBound = true;
             }
@@ -1011,13 +1535,13 @@ void TypeChecker::visitEdge(edge_t &edge)
 
                 if (isUrgent && hasClockGuard)
                 {
-                    system->setUrgentTransition();
+                    recordFact(URGENT_TRANSITION);
                     handleWarning(edge.sync,
                                   "$Clock_guards_are_not_allowed_on_urgent_edges");
                 }
                 else if (receivesBroadcast && hasClockGuard)
                 {
-                    system->clockGuardRecvBroadcast();
+                    recordFact(CLOCK_GUARD_RECV_BROADCAST);
                     /*
                       This is now allowed, though it is expensive.
 
@@ -1055,49 +1579,13 @@ void TypeChecker::visitEdge(edge_t &edge)
                 }
             }
 
-            switch(syncUsed)
+            if (task)
             {
-            case sync_use_t::unused:
-                switch(edge.sync.getSync())
-                {
-                case SYNC_BANG:
-                case SYNC_QUE:
-                    syncUsed = sync_use_t::io;
-                    break;
-                case SYNC_CSP:
-                    syncUsed = sync_use_t::csp;
-                    break;
-                }
-                break;
-            case sync_use_t::io:
-                switch(edge.sync.getSync())
-                {
-                case SYNC_BANG:
-                case SYNC_QUE:
-                    // ok
-                    break;
-                case SYNC_CSP:
-                    syncError = true;
-                    handleError(edge.sync, "$Assumed_IO_but_found_CSP_synchronization");
-                    break;
-                }
-                break;
-            case sync_use_t::csp:
-                switch(edge.sync.getSync())
-                {
-                case SYNC_BANG:
-                case SYNC_QUE:
-                    syncError = true;
-                    handleError(edge.sync, "$Assumed_CSP_but_found_IO_synchronization");
-                    break;
-                case SYNC_CSP:
-                    // ok
-                    break;
-                }
-                break;
-            default:
-            // nothing
-            ;
+                task->diagnostics.push_back({false, position_t(), std::string(), edge.sync});
+            }
+            else
+            {
+                checkSyncUsage(edge.sync);
             }
 
             if (refinementWarnings)
@@ -1206,6 +1694,12 @@ void TypeChecker::visitUpdate(update_t &update) {
 
 void TypeChecker::visitProgressMeasure(progress_t &progress)
 {
+    if (collecting)
+    {
+        addTask(false, [&progress](TypeChecker &c) { c.visitProgressMeasure(progress); });
+        return;
+    }
+
     checkExpression(progress.guard);
     checkExpression(progress.measure);
 
@@ -1224,6 +1718,12 @@ void TypeChecker::visitProgressMeasure(progress_t &progress)
 
 void TypeChecker::visitGanttChart(gantt_t &gc)
 {
+    if (collecting)
+    {
+        addTask(false, [&gc](TypeChecker &c) { c.visitGanttChart(gc); });
+        return;
+    }
+
     size_t n = gc.parameters.getSize();
     for(size_t i = 0; i < n; ++i)
     {
@@ -1257,6 +1757,16 @@ void TypeChecker::visitGanttChart(gantt_t &gc)
 
 void TypeChecker::visitInstance(instance_t &instance)
 {
+    if (collecting)
+    {
+        addTask(true, [&instance](TypeChecker &c) { c.visitInstance(instance); });
+        return;
+    }
+    if (isErrorLimitReached())
+    {
+        return;
+    }
+
     SystemVisitor::visitInstance(instance);
 
     /* Check the parameters of the instance.
@@ -1359,6 +1869,10 @@ static bool hasSpawnOrExit(expression_t expr) {
 
 void TypeChecker::visitProperty(expression_t expr)
 {
+    if (isErrorLimitReached())
+    {
+        return;
+    }
     if (checkExpression(expr))
     {
         if (expr.changesAnyVariable())
@@ -1566,6 +2080,10 @@ static bool validReturnType(type_t type)
 void TypeChecker::visitFunction(function_t &fun)
 {
     SystemVisitor::visitFunction(fun);
+    if (isErrorLimitReached())
+    {
+        return;
+    }
     /* Check that the return type is consistent and is a valid return
      * type.
      */
@@ -1694,6 +2212,7 @@ int32_t TypeChecker::visitBlockStatement(BlockStatement *stat)
     {
         symbol_t symbol = frame[i];
         checkType(symbol.getType());
+        resolveBounds(symbol);
         if (symbol.getData())
         {
             variable_t *var = static_cast<variable_t*>(symbol.getData());
@@ -2114,6 +2633,15 @@ bool TypeChecker::checkExpression(expression_t expr)
         return true;
     }
 
+    /* Shared sub-expressions (e.g. instantiation arguments) are only
+     * checked once per checker.
+     */
+    if (expr.getEpoch() == epoch)
+    {
+        skipped++;
+        return true;
+    }
+
     /* CheckExpression sub-expressions.
      */
     bool ok = true;
@@ -3157,6 +3685,7 @@ bool TypeChecker::checkExpression(expression_t expr)
     else
     {
         expr.setType(type);
+        expr.setEpoch(epoch);
         return true;
     }
 }
@@ -3311,11 +3840,14 @@ bool TypeChecker::isUniqueReference(expression_t expr) const
 
 bool parseXTA(FILE *file, TimedAutomataSystem *system, bool newxta)
 {
+    Statistics::Scope scope(system->getStatistics());
     SystemBuilder builder(system);
     parseXTA(file, &builder, newxta);
     if (!system->hasErrors())
     {
+        Statistics::Phase phase(Statistics::TYPE_CHECKING);
         TypeChecker checker(system);
+        checker.setThreads(system->getTypeCheckThreads());
         system->accept(checker);
     }
     return !system->hasErrors();
@@ -3323,22 +3855,27 @@ bool parseXTA(FILE *file, TimedAutomataSystem *system, bool newxta)
 
 bool parseXTA(const char *buffer, TimedAutomataSystem *system, bool newxta)
 {
+    Statistics::Scope scope(system->getStatistics());
     SystemBuilder builder(system);
     parseXTA(buffer, &builder, newxta);
     if (!system->hasErrors())
     {
+        Statistics::Phase phase(Statistics::TYPE_CHECKING);
         TypeChecker checker(system);
+        checker.setThreads(system->getTypeCheckThreads());
         system->accept(checker);
     }
     return !system->hasErrors();
 }
 
-int32_t parseXMLBuffer(const char *buffer, TimedAutomataSystem *system, bool newxta)
+int32_t parseXMLBuffer(const char *buffer, TimedAutomataSystem *system, bool newxta,
+                       int options)
 {
     int err;
 
+    Statistics::Scope scope(system->getStatistics());
     SystemBuilder builder(system);
-    err = parseXMLBuffer(buffer, &builder, newxta);
+    err = parseXMLBuffer(buffer, &builder, newxta, options);
 
     if (err)
     {
@@ -3347,19 +3884,23 @@ int32_t parseXMLBuffer(const char *buffer, TimedAutomataSystem *system, bool new
 
     if (!system->hasErrors())
     {
+        Statistics::Phase phase(Statistics::TYPE_CHECKING);
         TypeChecker checker(system);
+        checker.setThreads(system->getTypeCheckThreads());
         system->accept(checker);
     }
 
     return 0;
 }
 
-int32_t parseXMLFile(const char *file, TimedAutomataSystem *system, bool newxta)
+int32_t parseXMLFile(const char *file, TimedAutomataSystem *system, bool newxta,
+                     int options)
 {
     int err;
 
+    Statistics::Scope scope(system->getStatistics());
     SystemBuilder builder(system);
-    err = parseXMLFile(file, &builder, newxta);
+    err = parseXMLFile(file, &builder, newxta, options);
     if (err)
     {
         return err;
@@ -3367,7 +3908,9 @@ int32_t parseXMLFile(const char *file, TimedAutomataSystem *system, bool newxta)
 
     if (!system->hasErrors())
     {
+        Statistics::Phase phase(Statistics::TYPE_CHECKING);
         TypeChecker checker(system);
+        checker.setThreads(system->getTypeCheckThreads());
         system->accept(checker);
     }
 
@@ -3395,9 +3938,24 @@ void TypeChecker::visitTemplateAfter (template_t& t) {
 }
 
 bool TypeChecker::visitTemplateBefore (template_t& t) {
+    if (isErrorLimitReached())
+    {
+        return false;
+    }
+    if (collecting)
+    {
+        addTask(true, [&t](TypeChecker &c) { c.system->acceptTemplate(c, t); });
+        return false;
+    }
+
     assert(!temp);
     temp = &t;
 
+    for (uint32_t i = 0; i < t.parameters.getSize(); i++)
+    {
+        resolveBounds(t.parameters[i]);
+    }
+
     return true;
 
 }
@@ -120,6 +120,12 @@ namespace UTAP
 
         void handleError(const char *msg, ...);
 
+        /**
+         * Returns true if parsing should be abandoned, e.g. because
+         * too many errors have been reported.
+         */
+        virtual bool isAborted() const { return false; }
+
         /**
          * Must return true if and only if name is registered in the
          * symbol table as a named type, for instance, "int" or "bool" or
@@ -438,7 +444,8 @@ namespace UTAP
  * Parse a file in the XTA format, reporting the system to the given
  * implementation of the the ParserBuilder interface and reporting
  * errors to the ErrorHandler. If newxta is true, then the 4.x syntax
- * is used; otherwise the 3.x syntax is used. On success, this
+ * is used; otherwise the 3.x syntax is used. Files compressed with
+ * gzip or zstd are decoded while they are read. On success, this
  * function returns with a positive value.
  */
 int32_t parseXTA(FILE *, UTAP::ParserBuilder *, bool newxta);
@@ -461,21 +468,25 @@ int32_t parseXTA(const char*, UTAP::ParserBuilder *,
  * Parse a buffer in the XML format, reporting the system to the given
  * implementation of the the ParserBuilder interface and reporting
  * errors to the ErrorHandler. If newxta is true, then the 4.x syntax
- * is used; otherwise the 3.x syntax is used. On success, this
+ * is used; otherwise the 3.x syntax is used. The options are a
+ * combination of UTAP::xml_option_t values. On success, this
  * function returns with a positive value.
  */
 int32_t parseXMLBuffer(const char *buffer, UTAP::ParserBuilder *,
-                       bool newxta);
+                       bool newxta, int options = UTAP::XML_NO_OPTIONS);
 
 /**
  * Parse the file with the given name assuming it is in the XML
  * format, reporting the system to the given implementation of the the
  * ParserBuilder interface and reporting errors to the
  * ErrorHandler. If newxta is true, then the 4.x syntax is used;
- * otherwise the 3.x syntax is used. On success, this function returns
- * with a positive value.
+ * otherwise the 3.x syntax is used. The options are a combination of
+ * UTAP::xml_option_t values. Files compressed with gzip or zstd are
+ * decoded while they are read. On success, this function returns with
+ * a positive value.
  */
-int32_t parseXMLFile(const char *filename, UTAP::ParserBuilder *, bool newxta);
+int32_t parseXMLFile(const char *filename, UTAP::ParserBuilder *, bool newxta,
+                     int options = UTAP::XML_NO_OPTIONS);
 
 /**
  * Parse properties from a buffer. The properties are reported using
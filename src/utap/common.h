@@ -279,6 +279,15 @@ namespace UTAP
         S_PROBABILITY, /*LSC*/ S_INSTANCELINE, S_MESSAGE, S_UPDATE, S_CONDITION
     } xta_part_t;
 
+    /** Options for parsing and writing XML documents (may be or'ed together) */
+    typedef enum
+    {
+        XML_NO_OPTIONS = 0,
+        XML_SKIP_LAYOUT = 1, // skip nails, comments and other GUI-only data
+        XML_LAZY_TEMPLATES = 2, // only build templates used by the system
+        XML_NO_INDENT = 4 // write the document without indentation
+    } xml_option_t;
+
 }
 
 #endif
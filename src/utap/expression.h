@@ -31,6 +31,7 @@
 #include <set>
 #include <map>
 #include <memory>
+#include <functional>
 
 namespace UTAP
 {
@@ -102,6 +103,18 @@ namespace UTAP
          * with a symbol from the given frame(s), with the same name */
         expression_t deeperClone(frame_t frame, frame_t select = frame_t()) const;
 
+        /**
+         * Makes a clone of the expression in which the
+         * sub-expressions, the symbol and the type are replaced by
+         * the results of the given functions. Used when copying a
+         * system, where shared sub-expressions must map to a single
+         * clone.
+         */
+        expression_t rebuild(
+            const std::function<expression_t(expression_t)> &subs,
+            const std::function<symbol_t(symbol_t)> &symbols,
+            const std::function<type_t(type_t)> &types) const;
+
         /** Returns the kind of the expression. */
         Constants::kind_t getKind() const;
 
@@ -117,6 +130,13 @@ namespace UTAP
         /** Sets the type of the expression. */
         void setType(type_t);
 
+        /** Returns the epoch in which the expression was last
+            successfully type checked (0 if never). */
+        uint32_t getEpoch() const;
+
+        /** Marks the expression as type checked in the given epoch. */
+        void setEpoch(uint32_t);
+
         /** Returns the value field of this expression. This
             call is not valid for all expressions. */
         int32_t getValue() const;
@@ -200,11 +220,11 @@ namespace UTAP
 
          /** Less-than operator. Makes it possible to put expression_t
              objects into an STL set. */
-         bool operator < (const expression_t) const;
+         bool operator < (const expression_t &) const;
 
          /** Equality operator. Returns true if the two references point
              to the same expression object. */
-         bool operator == (const expression_t) const;
+         bool operator == (const expression_t &) const;
 
         expression_t subst(symbol_t, expression_t) const;
 
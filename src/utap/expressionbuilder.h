@@ -136,6 +136,7 @@ namespace UTAP
 
         void handleError(const std::string&) override;
         void handleWarning(const std::string&) override;
+        bool isAborted() const override;
         void typeDuplicate() override;
         void typePop() override;
         void typeBool(PREFIX) override;
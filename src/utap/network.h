@@ -0,0 +1,126 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+#ifndef UTAP_NETWORK_HH
+#define UTAP_NETWORK_HH
+
+#include "utap/system.h"
+
+#include <vector>
+#include <map>
+
+namespace UTAP
+{
+    /**
+     * A flattened, read-only view of the processes of a system with
+     * global numbering of processes, locations, edges and
+     * expressions, similar to the tables of the intermediate format
+     * read by the tracer. Each table is stored as a set of parallel
+     * arrays indexed by the global number of the element.
+     *
+     * The locations of process p are numbered
+     * getProcessFirstLocation(p) to getProcessFirstLocation(p + 1) - 1
+     * in the order of the locations of its template, and likewise the
+     * edges of p are numbered getProcessFirstEdge(p) to
+     * getProcessFirstEdge(p + 1) - 1.
+     * Expressions are numbered by identity: processes of the same
+     * template share the ids of the expressions of the template, and
+     * must be evaluated in the context of the process (its mapping).
+     * Absent expressions have id NONE.
+     *
+     * The network should be built after type checking and refers to
+     * the system, which must outlive it and must not be modified.
+     */
+    class Network
+    {
+    public:
+        static const int32_t NONE = -1;
+
+        enum location_flags_t : uint8_t {
+            NORMAL = 0, URGENT = 1, COMMITTED = 2
+        };
+
+        /** Builds the network of the processes of \a system. */
+        explicit Network(TimedAutomataSystem &system);
+
+        size_t getProcessCount() const { return processInstance.size(); }
+        size_t getLocationCount() const { return locationProcess.size(); }
+        size_t getEdgeCount() const { return edgeProcess.size(); }
+        size_t getExpressionCount() const { return expressions.size(); }
+
+        /* Processes; p may be getProcessCount() for the first
+         * location and edge, which then give the end. */
+        const instance_t *getProcessInstance(int32_t p) const { return processInstance[p]; }
+        int32_t getProcessInitial(int32_t p) const { return processInitial[p]; }
+        int32_t getProcessFirstLocation(int32_t p) const { return processLocations[p]; }
+        int32_t getProcessFirstEdge(int32_t p) const { return processEdges[p]; }
+
+        /* Locations */
+        const state_t *getLocationState(int32_t l) const { return locationState[l]; }
+        int32_t getLocationProcess(int32_t l) const { return locationProcess[l]; }
+        location_flags_t getLocationFlags(int32_t l) const { return (location_flags_t)locationFlags[l]; }
+        int32_t getLocationInvariant(int32_t l) const { return locationInvariant[l]; }
+
+        /* Edges (source and target are NONE for branchpoints) */
+        const edge_t *getEdge(int32_t e) const { return edgeEdge[e]; }
+        int32_t getEdgeProcess(int32_t e) const { return edgeProcess[e]; }
+        int32_t getEdgeSource(int32_t e) const { return edgeSource[e]; }
+        int32_t getEdgeTarget(int32_t e) const { return edgeTarget[e]; }
+        int32_t getEdgeGuard(int32_t e) const { return edgeGuard[e]; }
+        int32_t getEdgeSync(int32_t e) const { return edgeSync[e]; }
+        int32_t getEdgeUpdate(int32_t e) const { return edgeUpdate[e]; }
+        bool isEdgeControllable(int32_t e) const { return edgeControllable[e]; }
+
+        /* Expressions */
+        const expression_t &getExpression(int32_t id) const { return expressions[id]; }
+
+    private:
+        /* Processes */
+        std::vector<instance_t*> processInstance;
+        std::vector<int32_t> processInitial;      /**< Initial location */
+        std::vector<int32_t> processLocations;    /**< First location (+ end) */
+        std::vector<int32_t> processEdges;        /**< First edge (+ end) */
+
+        /* Locations */
+        std::vector<state_t*> locationState;
+        std::vector<int32_t> locationProcess;
+        std::vector<uint8_t> locationFlags;       /**< location_flags_t */
+        std::vector<int32_t> locationInvariant;   /**< Expression id */
+
+        /* Edges */
+        std::vector<edge_t*> edgeEdge;
+        std::vector<int32_t> edgeProcess;
+        std::vector<int32_t> edgeSource;          /**< Location */
+        std::vector<int32_t> edgeTarget;          /**< Location */
+        std::vector<int32_t> edgeGuard;           /**< Expression id */
+        std::vector<int32_t> edgeSync;            /**< Expression id */
+        std::vector<int32_t> edgeUpdate;          /**< Expression id */
+        std::vector<uint8_t> edgeControllable;
+
+        /* Expressions */
+        std::vector<expression_t> expressions;
+
+        std::map<expression_t, int32_t> expressionIds;
+        int32_t addExpression(expression_t);
+    };
+}
+
+#endif
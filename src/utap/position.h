@@ -28,6 +28,8 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <memory>
+#include <unordered_set>
 
 namespace UTAP
 {
@@ -73,12 +75,20 @@ namespace UTAP
 
     private:
         std::vector<line_t> elements;
+        std::unordered_set<std::string> texts;
         const line_t &find(uint32_t, uint32_t, uint32_t) const;
     public:
         /** Add information about a line to the container. */
         void add(uint32_t position, uint32_t offset, uint32_t line,
                  const std::string& path);
 
+        /**
+         * Returns the stored copy of a diagnostic message or context,
+         * storing it first if needed. The copy lives as long as the
+         * container, so diagnostics with the same message share it.
+         */
+        const std::string &intern(const std::string &text);
+
         /**
          * Retrieves information about the line containing the given
          * position. The last line in the container is considered to
@@ -91,18 +101,36 @@ namespace UTAP
     };
 
 
+    /**
+     * An error or warning. Only the position is stored; the lines
+     * containing the start and the end of the error are looked up
+     * when needed. The message and context refer to texts interned
+     * in the positions, which the error keeps alive, so recording an
+     * error with a message seen before copies no strings.
+     *
+     * The start and end lines used to be the public members start
+     * and end; use getStart() and getEnd() instead.
+     */
     struct error_t
     {
-        Positions::line_t start;
-        Positions::line_t end;
         position_t position;
-        const std::string message;
-        const std::string context;
+        const std::string &message;
+        const std::string &context;
+
+        error_t(const std::shared_ptr<Positions> &positions,
+                position_t pos, const std::string &msg,
+                const std::string &ctx="")
+            : position{pos}, message{positions->intern(msg)},
+              context{positions->intern(ctx)}, positions{positions} {}
+
+        /** Returns the line containing the start of the error. */
+        const Positions::line_t &getStart() const;
 
-        error_t(Positions::line_t s, Positions::line_t e,
-                position_t pos, std::string msg, std::string ctx="")
-            : start{s}, end{e}, position{pos},
-              message{std::move(msg)}, context{std::move(ctx)} {}
+        /** Returns the line containing the end of the error. */
+        const Positions::line_t &getEnd() const;
+
+    private:
+        std::shared_ptr<const Positions> positions;
     };
 }
 
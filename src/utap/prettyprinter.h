@@ -26,15 +26,50 @@
 #include <vector>
 #include <ostream>
 #include <stack>
+#include <memory>
 #include "utap/abstractbuilder.h"
 
 namespace UTAP
 {
+    /**
+     * Text built by concatenating fragments. Concatenation shares
+     * the operands instead of copying them, and the fragments are
+     * only put together when the text is written to a stream or
+     * converted to a string.
+     */
+    class text_t
+    {
+    private:
+        struct node_t
+        {
+            std::string text;
+            std::shared_ptr<node_t> left, right;
+            ~node_t();
+        };
+        std::shared_ptr<node_t> node;
+    public:
+        text_t() = default;
+        text_t(std::string text);
+        text_t(const char *text);
+        text_t(char c);
+
+        text_t &operator+=(const text_t &);
+        friend text_t operator+(const text_t &, const text_t &);
+
+        /** Writes the text to the stream. */
+        void write(std::ostream &) const;
+
+        /** Returns the text as a string. */
+        std::string str() const;
+    };
+
+    text_t operator+(const text_t &, const text_t &);
+    std::ostream &operator<<(std::ostream &, const text_t &);
 
     class PrettyPrinter : public AbstractBuilder
     {
     private:
-        std::vector<std::string> st;
+        std::vector<text_t> st;
         std::stack<std::string> type;
         std::stack<std::string> array;
         std::vector<std::string> fields;
@@ -0,0 +1,186 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+#ifndef UTAP_STATISTICS_H
+#define UTAP_STATISTICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <iosfwd>
+#include <vector>
+
+namespace UTAP
+{
+    /**
+     * Instrumentation of the loading of a model. Records the time
+     * spent in each phase of loading and the number of objects and
+     * bytes allocated for each kind of object.
+     *
+     * Phases nest: the time spent in a phase excludes the time spent
+     * in the phases entered from it, e.g. reading an XML document
+     * excludes parsing the declarations it contains, which in turn
+     * excludes building them.
+     *
+     * Objects are counted for the statistics made active for the
+     * calling thread by a Scope, as the factories of expressions,
+     * types, symbols and frames do not know the system they belong
+     * to. Counting is thread safe, such that workers of the type
+     * checker may share the statistics. When no statistics are
+     * active, the cost of instrumentation is a single test.
+     */
+    class Statistics
+    {
+    public:
+        enum phase_t {
+            XML_READING,        /**< Reading the XML document */
+            PARSING,            /**< Lexing and parsing */
+            BUILDING,           /**< Building the system */
+            TYPE_CHECKING,      /**< Type checking the system */
+            PHASES
+        };
+
+        enum counter_t {
+            EXPRESSIONS,
+            TYPES,
+            SYMBOLS,
+            FRAMES,
+            POSITIONS,
+            ERRORS,
+            WARNINGS,
+            COUNTERS
+        };
+
+        Statistics();
+        Statistics(const Statistics &) = delete;
+        Statistics &operator=(const Statistics &) = delete;
+
+        /** Returns the time in seconds spent in the phase. */
+        double getTime(phase_t) const;
+
+        /** Returns the number of objects of the given kind. */
+        uint64_t getCount(counter_t) const;
+
+        /**
+         * Returns the number of bytes allocated for objects of the
+         * given kind. This is the size of the shared data of the
+         * objects when created, excluding later growth.
+         */
+        uint64_t getBytes(counter_t) const;
+
+        /** Returns the name of the phase as used by writeJSON(). */
+        static const char *getName(phase_t);
+
+        /** Returns the name of the counter as used by writeJSON(). */
+        static const char *getName(counter_t);
+
+        /** Clears all times and counters. */
+        void reset();
+
+        /** Writes the times and counters as a JSON object. */
+        void writeJSON(std::ostream &) const;
+
+        /** Records an object of the given kind using \a bytes bytes. */
+        void add(counter_t counter, size_t bytes)
+        {
+            counts[counter].fetch_add(1, std::memory_order_relaxed);
+            this->bytes[counter].fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        /** Enters a phase, suspending the current phase. */
+        void enter(phase_t);
+
+        /** Leaves the current phase, resuming the enclosing phase. */
+        void leave();
+
+        /** Returns the statistics active for this thread, or NULL. */
+        static Statistics *current() { return active; }
+
+        /** Records an object with the active statistics, if any. */
+        static void record(counter_t counter, size_t bytes)
+        {
+            if (active)
+            {
+                active->add(counter, bytes);
+            }
+        }
+
+        /**
+         * Makes statistics active for the calling thread during the
+         * life time of the scope. \a statistics may be NULL.
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(Statistics *statistics)
+                : previous(active)
+            {
+                active = statistics;
+            }
+            ~Scope() { active = previous; }
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+        private:
+            Statistics *previous;
+        };
+
+        /**
+         * Spends the life time of the object in a phase of the active
+         * statistics, if any.
+         */
+        class Phase
+        {
+        public:
+            explicit Phase(phase_t phase)
+                : statistics(active)
+            {
+                if (statistics)
+                {
+                    statistics->enter(phase);
+                }
+            }
+            ~Phase()
+            {
+                if (statistics)
+                {
+                    statistics->leave();
+                }
+            }
+            Phase(const Phase &) = delete;
+            Phase &operator=(const Phase &) = delete;
+        private:
+            Statistics *statistics;
+        };
+
+    private:
+        typedef std::chrono::steady_clock clock;
+
+        static thread_local Statistics *active;
+
+        std::atomic<uint64_t> counts[COUNTERS];
+        std::atomic<uint64_t> bytes[COUNTERS];
+        clock::duration times[PHASES];
+        std::vector<phase_t> phases; // Stack of entered phases
+        clock::time_point mark;      // When the top phase was resumed
+    };
+}
+
+#endif
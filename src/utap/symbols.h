@@ -142,6 +142,24 @@ namespace UTAP
 
         /** Alters the type of this symbol */
         void setType(type_t);
+
+        /**
+         * Returns the range of the (element) values of this symbol
+         * as resolved by the type checker. The range is empty if the
+         * symbol is not integral or a scalar set, or if the bounds
+         * depend on template parameters.
+         */
+        range_t getRange() const;
+
+        /**
+         * Returns the number of elements of this symbol as resolved
+         * by the type checker, i.e. the product of its array sizes
+         * (1 for non-arrays). Returns 0 if unknown.
+         */
+        uint32_t getElementCount() const;
+
+        /** Sets the resolved range and number of elements. */
+        void setBounds(const range_t &, uint32_t elements);
         
         /** Returns the user data of this symbol */
         void *getData();
@@ -206,6 +224,9 @@ namespace UTAP
 
         /** Inequality operator */
         bool operator != (const frame_t &) const;
+
+        /** Less-than operator */
+        bool operator < (const frame_t &) const;
         
         /** Returns the number of symbols in this frame */
         uint32_t getSize() const;
@@ -26,13 +26,16 @@
 #include "utap/symbols.h"
 #include "utap/expression.h"
 #include "utap/position.h"
+#include "utap/statistics.h"
 
 #include <list>
 #include <deque>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <exception>
 #include <algorithm>
+#include <iosfwd>
 
 namespace UTAP
 {
@@ -102,6 +105,54 @@ namespace UTAP
         std::list<int32_t> selectValues;  /**<The select values, if any */
     };
 
+    /** A range of edges of a template, given by a contiguous
+        sequence of indices into template_t::edges.
+    */
+    class edge_range_t
+    {
+    public:
+        class iterator
+        {
+        public:
+            iterator(std::deque<edge_t> *edges, const uint32_t *index)
+                : edges(edges), index(index) {}
+            edge_t &operator*() const { return (*edges)[*index]; }
+            edge_t *operator->() const { return &(*edges)[*index]; }
+            iterator &operator++() { ++index; return *this; }
+            bool operator==(const iterator &i) const { return index == i.index; }
+            bool operator!=(const iterator &i) const { return index != i.index; }
+            /** Returns the index of the edge in template_t::edges. */
+            uint32_t getIndex() const { return *index; }
+        private:
+            std::deque<edge_t> *edges;
+            const uint32_t *index;
+        };
+
+        edge_range_t(std::deque<edge_t> *edges,
+                     const uint32_t *first, const uint32_t *last)
+            : edges(edges), first(first), last(last) {}
+        iterator begin() const { return iterator(edges, first); }
+        iterator end() const { return iterator(edges, last); }
+        size_t size() const { return last - first; }
+        bool empty() const { return first == last; }
+    private:
+        std::deque<edge_t> *edges;
+        const uint32_t *first;
+        const uint32_t *last;
+    };
+
+    /** Compressed sparse row index of the edges of a template: the
+        edges of node n are edges[offsets[n]] to edges[offsets[n + 1] - 1],
+        where nodes are locations (by locNr) or branchpoints (by bpNr)
+        and edges are indices into template_t::edges.
+    */
+    struct edge_index_t
+    {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> edges;
+        size_t size{0};             /**< Edges of the template when built */
+    };
+
     class BlockStatement; // Forward declaration
 
     /** Information about a function. The symbol's user data points to
@@ -173,6 +224,7 @@ namespace UTAP
         bool addFunction(type_t type, const std::string&, function_t *&);
         /** The following methods are used to write the declarations in an XML file */
         std::string toString(bool global = false) const;
+        void write(std::ostream &, bool global = false) const;
         std::string getConstants() const;
         std::string getTypeDefinitions() const;
         std::string getVariables(bool global) const;
@@ -219,35 +271,23 @@ namespace UTAP
         bool isInPrechart;
     };
 
+    /** A simultaneous region of an LSC. The parts point into the
+        deques of the template and are NULL if absent. */
     struct simregion_t
     {
-        int nr;
-        message_t* message;              /** May be empty */
-        condition_t* condition;          /** May be empty */
-        update_t* update;                /** May be empty */
+        int nr = -1;
+        message_t* message = nullptr;      /**< May be NULL */
+        condition_t* condition = nullptr;  /**< May be NULL */
+        update_t* update = nullptr;        /**< May be NULL */
+
+        bool hasMessage() const { return message != nullptr; }
+        bool hasCondition() const { return condition != nullptr; }
+        bool hasUpdate() const { return update != nullptr; }
 
         int getLoc() const;
         bool isInPrechart() const;
 
-        simregion_t()
-        {
-            message = new message_t();
-            condition = new condition_t();
-            update = new update_t();
-        }
-
-        ~simregion_t()
-        {
-            delete message;
-            delete condition;
-            delete update;
-        }
-
         std::string toString() const;
-
-        void setMessage(std::deque<message_t>& messages, int nr);
-        void setCondition(std::deque<condition_t>& conditions, int nr);
-        void setUpdate(std::deque<update_t>& updates, int nr);
     };
 
     struct compare_simregion
@@ -258,19 +298,40 @@ namespace UTAP
         }
     };
 
+    /** A set of simregions. Besides the simregions themselves, a cut
+        keeps a bitset over the simregion numbers (simregion_t::nr),
+        so membership, equality and hashing are word operations. */
     struct cut_t
     {
         int nr;
-        std::vector<simregion_t> simregions; //unordered
         cut_t(int number) {
-            simregions.clear();
             nr = number;
         };
-        void add(simregion_t s) {
-            simregions.push_back(s);
+        /** Adds s unless the cut already contains it. Simregions
+            which have not been numbered are ignored, as they can
+            never be in a cut. */
+        void add(const simregion_t& s) {
+            if (s.nr >= 0 && !contains(s)) {
+                set(s.nr);
+                simregions.push_back(s);
+            }
+        };
+        void erase(const simregion_t& s);
+        /** Returns true if s is in the cut. Simregions which have
+            not been numbered (nr is -1) are never in a cut. */
+        bool contains(const simregion_t& s) const {
+            if (s.nr < 0) {
+                return false;
+            }
+            size_t word = s.nr / 64;
+            return word < bits.size() && (bits[word] >> (s.nr % 64) & 1);
+        };
+        size_t hash() const;
+
+        /** Returns the simregions of the cut, in no particular order. */
+        const std::vector<simregion_t>& getSimregions() const {
+            return simregions;
         };
-        void erase(simregion_t s);
-        bool contains(simregion_t s);
 
         /**
          * returns true if the cut is in the prechart,
@@ -285,7 +346,8 @@ namespace UTAP
         bool isInPrechart(const simregion_t& fSimregion) const;
         bool isInPrechart() const;
 
-        bool equals(const cut_t& y) const;
+        bool equals(const cut_t& y) const { return bits == y.bits; };
+        bool operator==(const cut_t& y) const { return equals(y); };
 
         std::string toString() const {
             std::string s="CUT(";
@@ -295,6 +357,20 @@ namespace UTAP
             s += ")";
             return s;
         };
+
+    private:
+        std::vector<simregion_t> simregions; //unordered
+        std::vector<uint64_t> bits;   /**< Numbers of the simregions */
+        void set(int nr);
+    };
+
+    /** Hash function for using cuts in unordered containers. */
+    struct hash_cut
+    {
+        size_t operator() (const cut_t& cut) const
+        {
+            return cut.hash();
+        }
     };
 
     /**
@@ -361,6 +437,25 @@ namespace UTAP
         std::vector<expression_t> dynamicEvals;
         bool isTA;
 
+        /** Outgoing and incoming edges of locations and branchpoints */
+        edge_index_t outgoing, incoming, outgoingb, incomingb;
+
+        /** (Re)builds the edge indices. Called by the SystemBuilder
+            at the end of a template; must be called again if edges
+            are changed in place later on. */
+        void buildEdgeIndex();
+
+        /** Returns the edges leaving or entering a location or
+            branchpoint of the template, or an empty range if its
+            number is not one of the template. The edge indices are rebuilt
+            first if locations, branchpoints or edges have been added
+            since they were built, so such a call must not run
+            concurrently with other calls on the template. */
+        edge_range_t getOutgoingEdges(const state_t &);
+        edge_range_t getIncomingEdges(const state_t &);
+        edge_range_t getOutgoingEdges(const branchpoint_t &);
+        edge_range_t getIncomingEdges(const branchpoint_t &);
+
         int addDynamicEval (expression_t t) {
             dynamicEvals.push_back (t);
             return dynamicEvals.size()-1;
@@ -416,7 +511,9 @@ namespace UTAP
 
         /* returns the first update on one of the given instances, at y location */
         bool getUpdate(const std::vector<instanceLine_t*>& instances, int y, update_t*& simUpdate);
-       
+
+    private:
+        void updateEdgeIndex();
     };
 
     /**
@@ -466,13 +563,41 @@ namespace UTAP
         virtual void visitMessage(message_t &) {}
         virtual void visitCondition(condition_t &) {}
         virtual void visitUpdate(update_t &) {}
+
+        /**
+         * Returns a new visitor in the same state as this one, or
+         * NULL if the visitor cannot be cloned. Used by
+         * TimedAutomataSystem::acceptParallel() to give each worker
+         * its own visitor once the global declarations have been
+         * visited. The caller owns the result.
+         */
+        virtual SystemVisitor *clone() const { return NULL; }
+
+        /**
+         * Merges the results of a worker, i.e. a clone of this
+         * visitor used by acceptParallel(), into this visitor.
+         */
+        virtual void reduce(SystemVisitor &) {}
     };
 
     class TimedAutomataSystem
     {
     public:
         TimedAutomataSystem();
+
+        /**
+         * Makes a deep copy of a system, which can be type checked
+         * independently of the original and stays valid after the
+         * original is destroyed. For a type checked system, copying
+         * takes about as long as parsing it again (see the copy phase
+         * of utap-bench).
+         */
         TimedAutomataSystem(const TimedAutomataSystem&);
+        /* A system cannot be assigned, as the member wise assignment
+         * would share the frames and expressions of the two systems;
+         * use the copy constructor instead.
+         */
+        TimedAutomataSystem &operator=(const TimedAutomataSystem&) = delete;
         virtual ~TimedAutomataSystem();
 
         /** Returns the global declarations of the system. */
@@ -486,6 +611,13 @@ namespace UTAP
         /** Returns the processes of the system. */
         std::list<instance_t> &getProcesses();
 
+        /** Returns the template, instance (including LSC instances)
+            or process with the given name, or NULL if there is
+            none. */
+        template_t *findTemplate(const std::string& name) const;
+        instance_t *findInstance(const std::string& name) const;
+        instance_t *findProcess(const std::string& name) const;
+
         /** Returns the queries enclosed in the model. */
         queries_t &getQueries();
 
@@ -524,6 +656,22 @@ namespace UTAP
         void addGantt(declarations_t*, gantt_t&);
         void accept(SystemVisitor &);
 
+        /** Visits a single template and its contents in the same
+            order as accept() does. */
+        void acceptTemplate(SystemVisitor &, template_t &);
+
+        /**
+         * Like accept(), but visits the templates on up to \a threads
+         * workers. The visitor is cloned for each worker after the
+         * global declarations have been visited. Each worker visits a
+         * contiguous range of templates with its own clone, and the
+         * clones are reduced into the visitor in template order
+         * before the processes and instances are visited. The visitor callbacks
+         * must not modify the system. Falls back to accept() if the
+         * visitor cannot be cloned.
+         */
+        void acceptParallel(SystemVisitor &, size_t threads);
+
         void setBeforeUpdate(expression_t);
         expression_t getBeforeUpdate();
         void setAfterUpdate(expression_t);
@@ -543,9 +691,16 @@ namespace UTAP
         /** Sets process priority for process \a name. */
         void setProcPriority(const char* name, int priority);
 
-        /** Returns process priority for process \a name. */
+        /**
+         * Returns process priority for process \a name. Prefer the
+         * std::string overload, e.g. with the name of the process
+         * symbol, as this one copies the name for the lookup.
+         */
         int getProcPriority(const char* name) const;
 
+        /** Returns process priority for process \a name. */
+        int getProcPriority(const std::string& name) const;
+
         /** Returns true if system has some priority declaration. */
         bool hasPriorityDeclaration() const;
 
@@ -586,7 +741,7 @@ namespace UTAP
         bool hasGuardOnRecvBroadcast;
         int defaultChanPriority;
         std::list<chan_priority_t> chanPriorities;
-        std::map<std::string,int> procPriority;
+        std::unordered_map<std::string,int> procPriority;
         sync_use_t syncUsed; // see typechecker
 
         // The list of templates.
@@ -604,6 +759,12 @@ namespace UTAP
         // List of processes.
         std::list<instance_t> processes;
 
+        // Name indices of the above
+        std::unordered_map<std::string, template_t*> templateIndex;
+        std::unordered_map<std::string, template_t*> dynamicTemplateIndex;
+        std::unordered_map<std::string, instance_t*> instanceIndex;
+        std::unordered_map<std::string, instance_t*> processIndex;
+
         // Global declarations
         declarations_t global;
 
@@ -626,13 +787,47 @@ namespace UTAP
         const std::vector<error_t> &getWarnings() const;
         void clearErrors();
         void clearWarnings();
+
+        /**
+         * Limits the number of errors recorded. Once \a limit errors
+         * have been recorded, further errors are dropped and parsing
+         * and type checking stop early. Zero (the default) means no
+         * limit.
+         */
+        void setErrorLimit(size_t limit);
+        size_t getErrorLimit() const;
+
+        /** Returns true if the error limit has been reached. */
+        bool isErrorLimitReached() const;
+
+        /**
+         * Sets the number of threads the parse functions use for type
+         * checking the system (see TypeChecker::setThreads()). The
+         * default is 1, i.e. serial type checking.
+         */
+        void setTypeCheckThreads(size_t threads);
+        size_t getTypeCheckThreads() const;
+
+        /**
+         * Enables or disables instrumentation of loading the
+         * system. When enabled, the parse functions taking a system
+         * record the time spent in each phase and the number of
+         * objects created. Enabling resets any earlier statistics.
+         */
+        void setStatisticsEnabled(bool enabled);
+
+        /** Returns the statistics, or NULL if not enabled. */
+        Statistics *getStatistics() const;
         bool isModified() const;
         void setModified(bool mod);
         iodecl_t* addIODecl();
     private:
         std::vector<error_t> errors;
         std::vector<error_t> warnings;
-        Positions positions;
+        size_t errorLimit{0};
+        size_t typeCheckThreads{1};
+        std::shared_ptr<Positions> positions{std::make_shared<Positions>()};
+        std::shared_ptr<Statistics> statistics;
     };
 }
 
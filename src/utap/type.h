@@ -26,6 +26,7 @@
 #include "utap/position.h"
 
 #include <cinttypes>
+#include <functional>
 #include <string>
 #include <memory> // shared_ptr
 
@@ -99,6 +100,9 @@ namespace UTAP
 
         explicit type_t(Constants::kind_t kind,
                         const position_t &pos, size_t size);
+
+        /** Computes the cached traits of the type. */
+        void computeTraits();
     public:
         /** 
          * Default constructor. This creates a null-type.
@@ -190,6 +194,16 @@ namespace UTAP
          */
         std::pair<expression_t, expression_t> getRange() const;
 
+        /**
+         * Returns a copy of the type in which every child is replaced
+         * by \a children(child) and the expression by \a
+         * expressions(expr). If nothing changes, the type itself is
+         * returned, i.e. the (immutable) type is shared.
+         */
+        type_t rebuild(
+            const std::function<type_t(type_t)> &children,
+            const std::function<expression_t(expression_t)> &expressions) const;
+
         /** Generates string representation of the type. */
         std::string toString() const;
 
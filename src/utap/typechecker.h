@@ -28,7 +28,10 @@
 #include "utap/statement.h"
 
 #include <exception>
+#include <functional>
+#include <mutex>
 #include <set>
+#include <vector>
 
 namespace UTAP
 {
@@ -45,6 +48,8 @@ namespace UTAP
     public:
         void visitVariable(variable_t &) override;
         void visitInstance(instance_t &) override;
+        SystemVisitor *clone() const override;
+        void reduce(SystemVisitor &) override;
         bool contains(symbol_t) const;
     };
 
@@ -53,6 +58,13 @@ namespace UTAP
      * checker can only visit the system given in the constructor. The
      * type checker must not be constructed before the system has been
      * parsed.
+     *
+     * When more than one thread is requested with setThreads(), the
+     * global declarations are checked first and templates, instances
+     * and processes are then checked concurrently by worker
+     * checkers. Workers buffer their diagnostics, which are merged
+     * in source order once all workers are done, so the errors and
+     * warnings are the same as when checking serially.
      */
     class TypeChecker : public SystemVisitor, public AbstractStatementVisitor
     {
@@ -84,14 +96,75 @@ namespace UTAP
 
         bool isCompileTimeComputable(expression_t expr) const;
         void checkType(type_t, bool initialisable = false, bool inStruct = false);
+        void resolveBounds(symbol_t);
+        void checkSyncUsage(expression_t sync);
+
+        /** Facts about the system recorded while checking. */
+        enum fact_t
+        {
+            STRICT_INVARIANT = 1 << 0,
+            STOP_WATCH = 1 << 1,
+            STRICT_LOWER_BOUND_ON_CONTROLLABLE_EDGES = 1 << 2,
+            URGENT_TRANSITION = 1 << 3,
+            CLOCK_GUARD_RECV_BROADCAST = 1 << 4
+        };
+        void recordFact(fact_t);
+
+        /**
+         * A diagnostic buffered by a worker. Entries with a non-empty
+         * \a sync are deferred checks of the synchronisation usage,
+         * which depends on the order in which edges are visited.
+         */
+        struct diagnostic_t
+        {
+            bool warning;
+            position_t position;
+            std::string message;
+            expression_t sync;
+        };
+
+        /**
+         * A unit of work in parallel mode. Parallel tasks run on a
+         * worker and buffer their diagnostics and facts; serial tasks
+         * run on this checker while the buffers are merged.
+         */
+        struct task_t
+        {
+            bool parallel;
+            std::function<void(TypeChecker &)> run;
+            std::vector<diagnostic_t> diagnostics;
+            uint32_t facts{0};
+            size_t errors{0};
+            std::exception_ptr exception;
+        };
+
+        TypeChecker(const TypeChecker &parent, std::mutex &lock);
+        void addTask(bool parallel, std::function<void(TypeChecker &)>);
+        bool isErrorLimitReached() const;
+        void runTasks();
 
     public:
         TypeChecker(TimedAutomataSystem *system, bool refinement = false);
         ~TypeChecker() override {}
+
+        /**
+         * Sets the number of threads used when visiting the
+         * system. The default is 1, i.e. serial type checking.
+         */
+        void setThreads(size_t threads);
+
+        /**
+         * Returns the number of times an already type checked
+         * expression was encountered again and skipped.
+         */
+        size_t getSkippedExpressions() const { return skipped; }
+
+        void visitSystemBefore(TimedAutomataSystem *) override;
         void visitTemplateAfter (template_t& ) override;
         bool visitTemplateBefore(template_t& ) override;
         void visitSystemAfter(TimedAutomataSystem *) override;
         void visitVariable(variable_t &) override;
+        void visitTypeDef(symbol_t) override;
         void visitState(state_t &) override;
         void visitEdge(edge_t &) override;
         void visitInstance(instance_t &) override;
@@ -128,6 +201,14 @@ namespace UTAP
         bool syncError{false}; // true when sync usage is inconsistent (mix of io and csp)
         template_t* temp{nullptr};
 
+        size_t threads{1};
+        bool collecting{false};       /**< True while queueing tasks. */
+        std::vector<task_t> tasks;    /**< Queued tasks in source order. */
+        task_t *task{nullptr};        /**< Current task of a worker. */
+        std::mutex *typeLock{nullptr}; /**< Guards shared type expressions. */
+        uint32_t epoch;               /**< Marks expressions checked by us. */
+        size_t skipped{0};            /**< Expressions not checked twice. */
+
         /** check expressions used in (SMC) properties, these functions provide:
             1) consistent semantic checks by code reuse,
             2) meaningful names to the otherwise anonymous expressions.
@@ -33,9 +33,16 @@
 
 bool parseXTA(FILE *, UTAP::TimedAutomataSystem *, bool newxta);
 bool parseXTA(const char *, UTAP::TimedAutomataSystem *, bool newxta);
-int32_t parseXMLBuffer(const char *, UTAP::TimedAutomataSystem *, bool newxta);
-int32_t parseXMLFile(const char *, UTAP::TimedAutomataSystem *, bool newxta);
+int32_t parseXMLBuffer(const char *, UTAP::TimedAutomataSystem *, bool newxta,
+                       int options = UTAP::XML_NO_OPTIONS);
+int32_t parseXMLFile(const char *, UTAP::TimedAutomataSystem *, bool newxta,
+                     int options = UTAP::XML_NO_OPTIONS);
 UTAP::expression_t parseExpression(const char *, UTAP::TimedAutomataSystem *, bool);
-int32_t writeXMLFile(const char *filename, UTAP::TimedAutomataSystem* taSystem);
+int32_t writeXMLFile(const char *filename, UTAP::TimedAutomataSystem* taSystem,
+                     int options = UTAP::XML_NO_OPTIONS);
+int32_t writeXMLBuffer(std::string &buffer, UTAP::TimedAutomataSystem* taSystem,
+                       int options = UTAP::XML_NO_OPTIONS);
+int32_t writeXMLStream(int fd, UTAP::TimedAutomataSystem* taSystem,
+                       int options = UTAP::XML_NO_OPTIONS);
 
 #endif
@@ -0,0 +1,66 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+#ifndef UTAP_XMLDOCUMENT_H
+#define UTAP_XMLDOCUMENT_H
+
+#include <libxml/tree.h>
+#include <libxml/xpath.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace UTAP
+{
+    /**
+     * An XML document from which the contents of elements can be
+     * looked up by XPath, e.g. to show the source of the elements
+     * referred to by the positions of errors. The document is parsed
+     * once, and the contents found at each path are remembered, so
+     * many lookups cost no more than the parse.
+     */
+    class XMLDocument
+    {
+    private:
+        xmlDocPtr doc;
+        xmlXPathContextPtr context;
+        std::unordered_map<std::string, std::string> elements;
+
+        XMLDocument(const XMLDocument &);
+        XMLDocument &operator=(const XMLDocument &);
+    public:
+        /** Parses the given (nul terminated) XML buffer. */
+        explicit XMLDocument(const char *buffer);
+        ~XMLDocument();
+
+        /** Returns true if the buffer could be parsed. */
+        bool isValid() const { return context != NULL; }
+
+        /**
+         * Returns the contents of the first element at the given
+         * path. Returns the empty string if there is no such element
+         * or the document is invalid.
+         */
+        const std::string &getElement(const std::string &path);
+    };
+}
+
+#endif
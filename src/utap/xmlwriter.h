@@ -56,6 +56,7 @@ namespace UTAP {
     public: // was private - needed for derived class SBMLtoXMLWriter
         xmlTextWriterPtr writer; /**< The underlying xmlTextWriter */
         TimedAutomataSystem* taSystem; /**< The system to write */
+        bool indent; /**< True if the document should be indented */
         std::map<int, int> selfLoops;
 
         void startDocument();
@@ -64,6 +65,9 @@ namespace UTAP {
         void endElement();
         void writeElement(const char* name, const char* content);
         void writeAttribute(const char* name, const char* value);
+        void writeAttribute(const char* name, int value, const char* prefix = "");
+        void writeDeclarations(const char* name, const declarations_t& decls,
+                               bool global);
         void writeString(const char* content);
         void xmlwriteString(const xmlChar* content);
 
@@ -75,7 +79,7 @@ namespace UTAP {
         void transition(const edge_t& edge);
         void nail(int x, int y);
 
-        void label(const char* kind, std::string data, int x, int y);
+        void label(const char* kind, const std::string& data, int x, int y);
         int source(const edge_t& edge);
         int target(const edge_t& edge);
         void selfLoop(int loc, float initialAngle, const edge_t& edge);
@@ -87,7 +91,8 @@ namespace UTAP {
         void system_instantiation();
 
     //public:
-        XMLWriter(xmlTextWriterPtr writer, TimedAutomataSystem* taSystem);
+        XMLWriter(xmlTextWriterPtr writer, TimedAutomataSystem* taSystem,
+                  int options = XML_NO_OPTIONS);
         virtual ~XMLWriter();
         void project();
     };
@@ -25,6 +25,8 @@
 #endif
 
 #include "utap/position.h"
+#include "utap/statistics.h"
+#include "utap/xmldocument.h"
 
 #include <libxml/xmlreader.h>
 #include <libxml/xpath.h>
@@ -33,12 +35,15 @@
 #include <stdexcept>
 #include <cstdarg>
 #include <cctype>
+#include <cstdio>
 #include <cstring>
 #include <cassert>
 #include <algorithm>
 #include <list>
 #include <vector>
 #include <map>
+#include <deque>
+#include <unordered_map>
 #include <sstream>
 
 using std::map;
@@ -69,6 +74,8 @@ namespace UTAP {
         , TAG_SBML
         // QUERIES
         , TAG_QUERIES, TAG_QUERY, TAG_FORMULA, TAG_COMMENT
+        // Number of tags
+        , TAG_COUNT
     };
 
 #include "tags.cc"
@@ -130,182 +137,288 @@ namespace UTAP {
     }
 
     /**
-     * Comparator structure for comparing two xmlChar* strings.
+     * Returns true if labels of the given kind are part of the model,
+     * i.e. not comments or other data only used by the GUI.
      */
-    struct compare_str {
+    static bool isModelLabel(const xmlChar *kind) {
+        static const char *const kinds[] = {
+            "invariant", "exponentialrate", "select", "guard",
+            "synchronisation", "assignment", "probability",
+            "message", "update", "condition"
+        };
+        if (kind == NULL) {
+            return true;
+        }
+        for (const char *k: kinds) {
+            if (strcmp((const char*) kind, k) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Hash and equality structures for xmlChar* strings.
+     */
+    struct hash_str {
+
+        size_t operator()(const xmlChar* x) const {
+            size_t h = 14695981039346656037ULL;
+            while (*x) {
+                h = (h ^ *x++) * 1099511628211ULL;
+            }
+            return h;
+        }
+    };
+
+    struct equal_str {
 
         bool operator()(const xmlChar* x, const xmlChar * y) const {
-            return (strcmp((const char*) x, (const char*) y) < 0);
+            return strcmp((const char*) x, (const char*) y) == 0;
         }
     };
 
     /**
-     * Path to current node. This path also contains information about
-     * the left siblings of the nodes. This information is used to
-     * generated an XPath expression.
+     * Returns the XPath step of a tag, or NULL if the tag cannot occur
+     * in a path. Sets \a indexed to true if the step is indexed by
+     * the position among the siblings with the same tag.
+     */
+    static const char *step(tag_t tag, bool &indexed) {
+        indexed = true;
+        switch (tag) {
+            case TAG_TEMPLATE: return "/template";
+            case TAG_LOCATION: return "/location";
+            case TAG_BRANCHPOINT: return "/branchpoint";
+            case TAG_TRANSITION: return "/transition";
+            case TAG_LABEL: return "/label";
+            case TAG_NAIL: return "/nail";
+            case TAG_LSC: return "/lscTemplate";
+            case TAG_YLOCCOORD: return "/ylocoord";
+            case TAG_INSTANCE: return "/instance";
+            case TAG_TEMPERATURE: return "/temperature";
+            case TAG_MESSAGE: return "/message";
+            case TAG_CONDITION: return "/condition";
+            case TAG_UPDATE: return "/update";
+            case TAG_ANCHOR: return "/anchor";
+            case TAG_SBML: return "/sbml";
+            case TAG_QUERY: return "/query";
+            default: break;
+        }
+        indexed = false;
+        switch (tag) {
+            case TAG_NTA: return "/nta";
+            case TAG_IMPORTS: return "/imports";
+            case TAG_DECLARATION: return "/declaration";
+            case TAG_INSTANTIATION: return "/instantiation";
+            case TAG_SYSTEM: return "/system";
+            case TAG_NAME: return "/name";
+            case TAG_PARAMETER: return "/parameter";
+            case TAG_INIT: return "/init";
+            case TAG_URGENT: return "/urgent";
+            case TAG_COMMITTED: return "/committed";
+            case TAG_SOURCE: return "/source";
+            case TAG_TARGET: return "/target";
+            case TAG_PROJECT: return "/project";
+            case TAG_TYPE: return "/type";
+            case TAG_MODE: return "/mode";
+            case TAG_LSCLOCATION: return "/lsclocation";
+            case TAG_PRECHART: return "/prechart";
+            case TAG_QUERIES: return "/queries";
+            case TAG_FORMULA: return "/formula";
+            default: return NULL;
+        }
+    }
+
+    /**
+     * Path to current node. For every level of the path we keep the
+     * number of children seen so far with each tag and the last of
+     * these children. The XPath of the last child on each level is
+     * maintained in a buffer as the children are pushed, so get()
+     * only needs to look for the level at which to cut the buffer.
      *
      * @see get()
      */
     class Path {
     private:
-        list<vector<tag_t> > path;
+        struct level_t {
+            tag_t tag;                  /**< Last child, TAG_NONE if none */
+            bool valid;                 /**< False if tag has no XPath step */
+            size_t end;                 /**< End of the XPath of tag */
+            uint32_t count[TAG_COUNT];  /**< Number of children by tag */
+        };
+        vector<level_t> levels;
+        size_t depth;
+        string buffer;
+        mutable string paths[TAG_COUNT]; /**< Results of get() by tag */
+        void enter();
     public:
         Path();
         void push(tag_t);
         tag_t pop();
-        string get(tag_t tag = TAG_NONE) const;
+        Path before() const;
+        const string &get(tag_t tag = TAG_NONE) const;
     };
 
-    Path::Path() {
-        path.push_back(vector<tag_t > ());
+    Path::Path(): depth(0) {
+        levels.emplace_back();
+        enter();
+    }
+
+    /* Resets the counters of the current level, which has just been
+     * entered.
+     */
+    void Path::enter() {
+        level_t &level = levels[depth];
+        level.tag = TAG_NONE;
+        level.valid = true;
+        level.end = depth > 0 ? levels[depth - 1].end : 0;
+        std::fill(level.count, level.count + TAG_COUNT, 0);
     }
 
     void Path::push(tag_t tag) {
-        path.back().push_back(tag);
-        path.push_back(vector<tag_t > ());
+        level_t &level = levels[depth];
+        uint32_t n = ++level.count[tag];
+        bool indexed;
+        const char *name = step(tag, indexed);
+
+        buffer.resize(depth > 0 ? levels[depth - 1].end : 0);
+        if (name != NULL) {
+            buffer += name;
+            if (indexed) {
+                char index[16];
+                snprintf(index, sizeof(index), "[%u]", n);
+                buffer += index;
+            }
+        }
+        level.tag = tag;
+        level.valid = (name != NULL);
+        level.end = buffer.size();
+
+        if (++depth == levels.size()) {
+            levels.emplace_back();
+        }
+        enter();
     }
 
     tag_t Path::pop() {
-        path.pop_back();
-        return path.back().back();
-    }
-
-    /** Returns the XPath encoding of the current path. */
-    string Path::get(tag_t tag) const {
-        ostringstream str;
-        list<vector<tag_t> >::const_iterator i;
-        for (i = path.begin(); !i->empty() && i != path.end(); i++) {
-            switch (i->back()) {
-                case TAG_NTA:
-                    str << "/nta";
-                    break;
-                case TAG_IMPORTS:
-                    str << "/imports";
-                    break;
-                case TAG_DECLARATION:
-                    str << "/declaration";
-                    break;
-                case TAG_TEMPLATE:
-                    str << "/template[" <<
-                            std::count(i->begin(), i->end(), TAG_TEMPLATE) << "]";
-                    break;
-                case TAG_INSTANTIATION:
-                    str << "/instantiation";
-                    break;
-                case TAG_SYSTEM:
-                    str << "/system";
-                    break;
-                case TAG_NAME:
-                    str << "/name";
-                    break;
-                case TAG_PARAMETER:
-                    str << "/parameter";
-                    break;
-                case TAG_LOCATION:
-                    str << "/location["
-                            << std::count(i->begin(), i->end(), TAG_LOCATION) << "]";
-                    break;
-                case TAG_BRANCHPOINT:
-                    str << "/branchpoint["
-                            << std::count(i->begin(), i->end(), TAG_BRANCHPOINT) << "]";
-                    break;
-                case TAG_INIT:
-                    str << "/init";
-                    break;
-                case TAG_TRANSITION:
-                    str << "/transition[" <<
-                            std::count(i->begin(), i->end(), TAG_TRANSITION) << "]";
-                    break;
-                case TAG_LABEL:
-                    str << "/label[" <<
-                            std::count(i->begin(), i->end(), TAG_LABEL) << "]";
-                    break;
-                case TAG_URGENT:
-                    str << "/urgent";
-                    break;
-                case TAG_COMMITTED:
-                    str << "/committed";
-                    break;
-                case TAG_SOURCE:
-                    str << "/source";
-                    break;
-                case TAG_TARGET:
-                    str << "/target";
-                    break;
-                case TAG_NAIL:
-                    str << "/nail["
-                            << std::count(i->begin(), i->end(), TAG_NAIL) << "]";
-                    break;
-                case TAG_PROJECT:
-                    str << "/project";
-                    break;
-                case TAG_LSC:
-                    str << "/lscTemplate[" <<
-                            std::count(i->begin(), i->end(), TAG_LSC) << "]";
-                    break;
-                case TAG_TYPE:
-                    str << "/type";
-                    break;
-                case TAG_MODE:
-                    str << "/mode";
-                    break;
-                case TAG_YLOCCOORD:
-                    str << "/ylocoord[" <<
-                            std::count(i->begin(), i->end(), TAG_YLOCCOORD) << "]";
-                    break;
-                case TAG_LSCLOCATION:
-                    str << "/lsclocation";
-                    break;
-                case TAG_PRECHART:
-                    str << "/prechart";
-                    break;
-                case TAG_INSTANCE:
-                    str << "/instance["
-                            << std::count(i->begin(), i->end(), TAG_INSTANCE) << "]";
-                    break;
-                case TAG_TEMPERATURE:
-                    str << "/temperature["
-                            << std::count(i->begin(), i->end(), TAG_TEMPERATURE) << "]";
-                    break;
-                case TAG_MESSAGE:
-                    str << "/message["
-                            << std::count(i->begin(), i->end(), TAG_MESSAGE) << "]";
-                    break;
-                case TAG_CONDITION:
-                    str << "/condition["
-                            << std::count(i->begin(), i->end(), TAG_CONDITION) << "]";
-                    break;
-                case TAG_UPDATE:
-                    str << "/update["
-                            << std::count(i->begin(), i->end(), TAG_UPDATE) << "]";
-                    break;
-                case TAG_ANCHOR:
-                    str << "/anchor["
-                            << std::count(i->begin(), i->end(), TAG_ANCHOR) << "]";
-                    break;
-                case TAG_SBML:
-                    str << "/sbml["
-                            << std::count(i->begin(), i->end(), TAG_SBML) << "]";
-                    break;
-                case TAG_QUERIES:
-                    str << "/queries";
-                    break;
-                case TAG_QUERY:
-                    str << "/query["
-                            << std::count(i->begin(), i->end(), TAG_QUERY) << "]";
-                    break;
-                case TAG_FORMULA:
-                    str << "/formula";
-                    break;                
-                default:
-                    /* Strange tag on stack */
-                    throw std::logic_error("XPath is corrupted");
+        --depth;
+        return levels[depth].tag;
+    }
+
+    /**
+     * Returns the path as it was before the current element was
+     * pushed, such that pushing it again gives the current path.
+     */
+    Path Path::before() const {
+        Path result(*this);
+        level_t &level = result.levels[--result.depth];
+        --level.count[level.tag];
+        level.tag = TAG_NONE;
+        result.buffer.resize(result.depth > 0 ? levels[result.depth - 1].end : 0);
+        return result;
+    }
+
+    /**
+     * Returns the XPath encoding of the current path, up to and
+     * including the first element with the given tag. The result is
+     * kept in a buffer of the tag, which is reused by the next call
+     * with the same tag. As elements with the same tag do not nest,
+     * the result can be held while reading the element.
+     */
+    const string &Path::get(tag_t tag) const {
+        size_t end = 0;
+        for (size_t i = 0; i <= depth && levels[i].tag != TAG_NONE; i++) {
+            if (!levels[i].valid) {
+                /* Strange tag on stack */
+                throw std::logic_error("XPath is corrupted");
             }
-            if (i->back() == tag) {
+            end = levels[i].end;
+            if (levels[i].tag == tag) {
                 break;
             }
         }
-        return str.str();
+        paths[tag].assign(buffer, 0, end);
+        return paths[tag];
+    }
+
+    /**
+     * A template (or LSC template) element set aside by the lazy
+     * parser: a copy of the element, the path at which it occurred
+     * and the name of the template.
+     */
+    struct deferred_t {
+        tag_t tag;
+        xmlDocPtr doc;
+        Path path;
+        string name;
+    };
+
+    /**
+     * Computes the set of deferred templates reachable from some
+     * declarations. Any identifier naming a template makes it
+     * reachable, so the result may include a few templates too many
+     * but never too few.
+     */
+    class Reachability {
+    private:
+        std::unordered_map<string, vector<size_t>> templates;
+        vector<bool> reached;
+        vector<size_t> waiting;
+    public:
+        Reachability(const vector<deferred_t> &deferred);
+        void text(const char *text);
+        void tree(xmlNodePtr node);
+        void close(const vector<deferred_t> &deferred);
+        bool contains(size_t i) const { return reached[i]; }
+    };
+
+    Reachability::Reachability(const vector<deferred_t> &deferred)
+        : reached(deferred.size(), false) {
+        for (size_t i = 0; i < deferred.size(); i++) {
+            templates[deferred[i].name].push_back(i);
+        }
+    }
+
+    /** Marks the templates named in the given text as reachable. */
+    void Reachability::text(const char *text) {
+        const char *p = text;
+        while (*p) {
+            if (!isAlpha(*p)) {
+                p++;
+                continue;
+            }
+            const char *begin = p;
+            while (isIdChr(*p)) p++;
+            auto it = templates.find(string(begin, p - begin));
+            if (it != templates.end()) {
+                for (size_t i: it->second) {
+                    if (!reached[i]) {
+                        reached[i] = true;
+                        waiting.push_back(i);
+                    }
+                }
+            }
+        }
+    }
+
+    /** Marks the templates named in the text of the tree as reachable. */
+    void Reachability::tree(xmlNodePtr node) {
+        for (; node != NULL; node = node->next) {
+            if (node->type == XML_TEXT_NODE && node->content != NULL) {
+                text((const char*) node->content);
+            } else if (node->type == XML_ELEMENT_NODE) {
+                tree(node->children);
+            }
+        }
+    }
+
+    /** Adds the templates reachable from the reachable templates. */
+    void Reachability::close(const vector<deferred_t> &deferred) {
+        while (!waiting.empty()) {
+            size_t i = waiting.back();
+            waiting.pop_back();
+            tree(xmlDocGetRootElement(deferred[i].doc));
+        }
     }
 
     /**
@@ -314,12 +427,18 @@ namespace UTAP {
      */
     class XMLReader {
     private:
-        typedef map<xmlChar*, string, compare_str> elementmap_t;
+        typedef std::unordered_map<const xmlChar*, const string*, hash_str, equal_str> elementmap_t;
 
         xmlTextReaderPtr reader; /**< The underlying xmlTextReader */
-        elementmap_t names; /**< Map from location (or instance line) id's to location (or instance line) names. */
+        elementmap_t names; /**< Map from location (or instance line) id's of the current template to location (or instance line) names. */
+        std::deque<string> strings; /**< Storage for the id's and names in names. */
         ParserBuilder *parser; /**< The parser builder to which to push the model. */
         bool newxta; /**< True if we should use new syntax. */
+        bool skipLayout; /**< True if layout should be skipped. */
+        bool lazy; /**< True if only used templates should be built. */
+        bool fragment; /**< True if the document is a template set aside by the lazy parser. */
+        bool ended; /**< True if the end of a fragment has been read. */
+        vector<deferred_t> deferred; /**< Templates set aside by the lazy parser. */
         Path path;
         bool nta; /**< True if the enclosing tag is "nta" (false if it is "project") */
         int bottomPrechart; /**< y location of the prechart bottom */
@@ -330,11 +449,19 @@ namespace UTAP {
         bool isEmpty();
         int getNodeType();
         void read();
+        void skip();
+        int next();
+        void advance(int status);
         bool begin(tag_t, bool skipEmpty = true);
         bool end(tag_t);
 
-        const string getName(const xmlChar *id);
+        const xmlChar *getAttribute(const char *name);
+        const string &getName(const xmlChar *id);
+        void addName(const xmlChar *id, const string &name);
+        void clearNames();
         int parse(const xmlChar *, xta_part_t syntax);
+        int parse(const string &, xta_part_t syntax, const string &xpath);
+        bool section(tag_t tag, string &text, string &xpath);
 
         bool declaration();
         bool label(bool required = false, string kind = "");
@@ -348,18 +475,23 @@ namespace UTAP {
         string readString(tag_t tag, bool instanceLine = false);
         string readText(bool instanceLine = false);
         int readNumber();
-        string source();
-        string target();
+        const string &source();
+        const string &target();
         bool transition();
         bool templ();
         int parameter();
         bool instantiation();
         void system();
-        string reference(string attributeName);
+        void endSystem();
+        void missingSystem();
+        bool deferTemplate(tag_t tag);
+        void buildTemplate(const deferred_t &templ);
+        void lazyTemplates();
+        const string &reference(const char *attributeName);
 
         // LSC elements:
         bool lscTempl();
-        string anchor();
+        const string &anchor();
         vector<char*> anchors();
         string type();
         string mode();
@@ -380,21 +512,43 @@ namespace UTAP {
 
     public:
         XMLReader(
-                xmlTextReaderPtr reader, ParserBuilder *parser, bool newxta);
+                xmlTextReaderPtr reader, ParserBuilder *parser, bool newxta,
+                int options = XML_NO_OPTIONS);
+        XMLReader(
+                xmlTextReaderPtr reader, ParserBuilder *parser, bool newxta,
+                int options, const Path &path);
         virtual ~XMLReader();
         void project();
     };
 
     XMLReader::XMLReader(
-            xmlTextReaderPtr reader, ParserBuilder *parser, bool newxta)
-    : reader(reader), parser(parser), newxta(newxta) {
+            xmlTextReaderPtr reader, ParserBuilder *parser, bool newxta,
+            int options)
+    : reader(reader), parser(parser), newxta(newxta),
+      skipLayout(options & XML_SKIP_LAYOUT),
+      lazy(options & XML_LAZY_TEMPLATES), fragment(false), ended(false) {
+        read();
+    }
+
+    /**
+     * Creates a reader for a fragment, i.e. a document holding a
+     * single element which was found at the given path. The element
+     * ends the document, so the reader stops at the end of it rather
+     * than reporting a premature end of the document.
+     */
+    XMLReader::XMLReader(
+            xmlTextReaderPtr reader, ParserBuilder *parser, bool newxta,
+            int options, const Path &path)
+    : reader(reader), parser(parser), newxta(newxta),
+      skipLayout(options & XML_SKIP_LAYOUT),
+      lazy(options & XML_LAZY_TEMPLATES), fragment(true), ended(false),
+      path(path) {
         read();
     }
 
     XMLReader::~XMLReader() {
-        elementmap_t::iterator i;
-        for (i = names.begin(); i != names.end(); ++i) {
-            xmlFree(i->first);
+        for (deferred_t &templ: deferred) {
+            xmlFreeDoc(templ.doc);
         }
         xmlFreeTextReader(reader);
     }
@@ -426,11 +580,14 @@ namespace UTAP {
     /**
      * Read until start element. Returns true if that element has the
      * given tag. If skipEmpty is true, empty elements with the given
-     * tag are ignored.
+     * tag are ignored. Returns false at the end of a fragment.
      */
     bool XMLReader::begin(tag_t tag, bool skipEmpty) {
         for (;;) {
             while (getNodeType() != XML_READER_TYPE_ELEMENT) {
+                if (ended) {
+                    return false;
+                }
                 read();
             }
             if (getElement() != tag) {
@@ -469,7 +626,72 @@ namespace UTAP {
                 throw std::runtime_error("Invalid nesting in XML document");
             }
         }
-        if (xmlTextReaderRead(reader) != 1) {
+        advance(xmlTextReaderRead(reader));
+    }
+
+    /**
+     * Advances the reader past the current node and all of its
+     * children. It maintains the path to the current node.
+     */
+    void XMLReader::skip() {
+        if (getNodeType() == XML_READER_TYPE_ELEMENT) {
+            if (path.pop() != getElement()) {
+                /* Path is corrupted */
+                throw std::runtime_error("Invalid nesting in XML document");
+            }
+        }
+        advance(next());
+    }
+
+    /**
+     * Moves the reader past the current node and all of its children
+     * without maintaining the path. Returns the status of the move.
+     */
+    int XMLReader::next() {
+        if (!fragment) {
+            return xmlTextReaderNext(reader);
+        }
+
+        /* On the tree walker used for fragments, xmlTextReaderNext()
+         * skips the end of the parent of the last child, so read past
+         * the children instead.
+         */
+        if (getNodeType() == XML_READER_TYPE_ELEMENT && !isEmpty()) {
+            int depth = xmlTextReaderDepth(reader);
+            int status;
+            do {
+                status = xmlTextReaderRead(reader);
+            } while (status == 1
+                     && (getNodeType() != XML_READER_TYPE_END_ELEMENT
+                         || xmlTextReaderDepth(reader) != depth));
+            if (status != 1) {
+                return status;
+            }
+        }
+        return xmlTextReaderRead(reader);
+    }
+
+    /**
+     * Completes a move of the reader with the given status. When
+     * skipping layout, elements containing only layout are passed
+     * over without being read.
+     */
+    void XMLReader::advance(int status) {
+        while (status == 1 && skipLayout
+               && getNodeType() == XML_READER_TYPE_ELEMENT) {
+            tag_t tag = getElement();
+            if (tag != TAG_NAIL && tag != TAG_YLOCCOORD) {
+                break;
+            }
+            status = next();
+        }
+
+        if (status == 0 && fragment) {
+            /* The element of the fragment has been read. */
+            ended = true;
+            return;
+        }
+        if (status != 1) {
             /* Premature end of document. */
             throw std::runtime_error("Unexpected end of XML document");
         }
@@ -479,22 +701,92 @@ namespace UTAP {
         }
     }
 
+    /**
+     * Returns the value of an attribute of the current element, or
+     * NULL if the element has no such attribute. The value is owned
+     * by the reader and is valid until the next read.
+     */
+    const xmlChar *XMLReader::getAttribute(const char *name) {
+        const xmlChar *value = NULL;
+        if (xmlTextReaderMoveToAttribute(reader, (const xmlChar*) name) == 1) {
+            value = xmlTextReaderConstValue(reader);
+            xmlTextReaderMoveToElement(reader);
+        }
+        return value;
+    }
+
     /** Returns the name of a location. */
-    const string XMLReader::getName(const xmlChar *id) {
+    const string &XMLReader::getName(const xmlChar *id) {
         if (id) {
-            elementmap_t::iterator l = names.find((xmlChar*) id);
+            elementmap_t::iterator l = names.find(id);
             if (l != names.end()) {
-                return l->second;
+                return *l->second;
             }
         }
         throw std::runtime_error("Missing reference");
     }
 
+    /**
+     * Maps the id of a location, branchpoint or instance line of the
+     * current template to its name. Ids and names are copied to
+     * storage that lives until the end of the template.
+     */
+    void XMLReader::addName(const xmlChar *id, const string &name) {
+        if (id == NULL) {
+            return;
+        }
+        strings.push_back(name);
+        const string *value = &strings.back();
+        elementmap_t::iterator l = names.find(id);
+        if (l != names.end()) {
+            l->second = value;
+        } else {
+            strings.push_back((const char*) id);
+            names.emplace((const xmlChar*) strings.back().c_str(), value);
+        }
+    }
+
+    /** Forgets the ids of the current template. */
+    void XMLReader::clearNames() {
+        names.clear();
+        strings.clear();
+    }
+
     /** Invokes the bison generated parser to parse the given string. */
     int XMLReader::parse(const xmlChar *text, xta_part_t syntax) {
+        if (parser->isAborted()) {
+            return -1;
+        }
         return parseXTA((const char*) text, parser, newxta, syntax, path.get());
     }
 
+    /**
+     * Invokes the bison generated parser to parse the given string,
+     * which was read at the given path.
+     */
+    int XMLReader::parse(const string &text, xta_part_t syntax, const string &xpath) {
+        if (parser->isAborted()) {
+            return -1;
+        }
+        return parseXTA(text.c_str(), parser, newxta, syntax, xpath);
+    }
+
+    /**
+     * Reads an optional element containing declarations. Returns the
+     * text of the element and the path at which it should be parsed.
+     */
+    bool XMLReader::section(tag_t tag, string &text, string &xpath) {
+        if (begin(tag, false)) {
+            read();
+            xpath = path.get();
+            if (getNodeType() == XML_READER_TYPE_TEXT) {
+                text = (const char*) xmlTextReaderConstValue(reader);
+            }
+            return true;
+        }
+        return false;
+    }
+
     /** Parse optional declaration. */
     bool XMLReader::declaration() {
         if (begin(TAG_DECLARATION)) {
@@ -514,6 +806,11 @@ namespace UTAP {
         if (begin(TAG_LABEL)) {
             /* Get kind attribute. */
             kind = xmlTextReaderGetAttribute(reader, (const xmlChar *) "kind");
+            if (skipLayout && !isModelLabel(kind)) {
+                xmlFree(kind);
+                skip();
+                return true;
+            }
             read();
 
             /* Read the text and push it to the parser. */
@@ -564,6 +861,11 @@ namespace UTAP {
         if (begin(TAG_LABEL)) {
             /* Get kind attribute. */
             kind = xmlTextReaderGetAttribute(reader, (const xmlChar *) "kind");
+            if (skipLayout && !isModelLabel(kind)) {
+                xmlFree(kind);
+                skip();
+                return result;
+            }
             read();
 
             /* Read the text and push it to the parser. */
@@ -696,7 +998,7 @@ namespace UTAP {
 
         if (begin(TAG_LOCATION, false)) {
             try {
-                string l_path = path.get(TAG_LOCATION);
+                const string &l_path = path.get(TAG_LOCATION);
 
                 /* Extract ID attribute.
                  */
@@ -732,7 +1034,7 @@ namespace UTAP {
 
                 /* Remember the mapping from id to name
                  */
-                names[l_id] = l_name;
+                addName(l_id, l_name);
 
                 /* Any error messages generated by any of the
                  * procStateXXX calls must be attributed to the state
@@ -754,6 +1056,7 @@ namespace UTAP {
             } catch (TypeException &e) {
                 parser->handleError(e.what());
             }
+            xmlFree(l_id);
             return true;
         }
         return false;
@@ -766,7 +1069,7 @@ namespace UTAP {
 
         if (begin(TAG_INSTANCE, false)) {
             try {
-                string i_path = path.get(TAG_INSTANCE);
+                const string &i_path = path.get(TAG_INSTANCE);
 
                 /* Extract ID attribute.
                  */
@@ -782,7 +1085,7 @@ namespace UTAP {
 
                 /* Remember the mapping from id to name
                  */
-                names[i_id] = i_name;
+                addName(i_id, i_name);
 
                 /* Any error messages generated by the
                  * procInstanceLine call must be attributed to the
@@ -799,6 +1102,7 @@ namespace UTAP {
             } catch (TypeException &e) {
                 parser->handleError(e.what());
             }
+            xmlFree(i_id);
             return true;
         }
         return false;
@@ -826,7 +1130,7 @@ namespace UTAP {
     bool XMLReader::prechart() {
         if (begin(TAG_PRECHART, false)) {
             try {
-                string p_path = path.get(TAG_PRECHART);
+                const string &p_path = path.get(TAG_PRECHART);
 
                 /* Get the bottom location number
                  */
@@ -858,7 +1162,7 @@ namespace UTAP {
             /* Add dummy position mapping to the message element.
              */
             try {
-                string m_path = path.get(TAG_MESSAGE);
+                const string &m_path = path.get(TAG_MESSAGE);
                 read();
                 from = source();
                 to = target();
@@ -887,7 +1191,7 @@ namespace UTAP {
             bool pch, hot;
 
             try {
-                string c_path = path.get(TAG_CONDITION);
+                const string &c_path = path.get(TAG_CONDITION);
                 read();
 
                 instance_anchors = anchors();
@@ -917,7 +1221,7 @@ namespace UTAP {
             bool pch;
 
             try {
-                string u_path = path.get(TAG_UPDATE);
+                const string &u_path = path.get(TAG_UPDATE);
                 //location = atoi((char*)xmlTextReaderGetAttribute(reader, (const xmlChar*)"y"));
                 //pch = (location < bottomPrechart);
                 read();
@@ -946,7 +1250,7 @@ namespace UTAP {
 
         if (begin(TAG_BRANCHPOINT, false)) {
             try {
-                string b_path = path.get(TAG_BRANCHPOINT);
+                const string &b_path = path.get(TAG_BRANCHPOINT);
 
 
                 /* Extract ID attribute.
@@ -962,7 +1266,7 @@ namespace UTAP {
 
                 /* Remember the mapping from id to name
                  */
-                names[b_id] = b_name;
+                addName(b_id, b_name);
 
 
                 //FIXME: probably not necessary
@@ -980,6 +1284,7 @@ namespace UTAP {
             } catch (TypeException &e) {
                 parser->handleError(e.what());
             }
+            xmlFree(b_id);
             return true;
         }
         return false;
@@ -992,12 +1297,12 @@ namespace UTAP {
         if (begin(TAG_INIT, false)) {
             /* Get reference attribute.
              */
-            xmlChar *ref = xmlTextReaderGetAttribute(reader, (const xmlChar*) "ref");
+            const xmlChar *ref = getAttribute("ref");
 
             /* Find location name for the reference.
              */
             if (ref) {
-                string name = getName(ref);
+                const string &name = getName(ref);
                 try {
                     parser->procStateInit(name.c_str());
                 } catch (TypeException& te) {
@@ -1006,7 +1311,6 @@ namespace UTAP {
             } else {
                 parser->handleError("$Missing_initial_location");
             }
-            xmlFree(ref);
             read();
             return true;
         } else {
@@ -1015,31 +1319,28 @@ namespace UTAP {
         return false;
     }
 
-    string XMLReader::reference(string attributeName) {
-        string name;
-        xmlChar *id = xmlTextReaderGetAttribute(reader, (const xmlChar*) attributeName.c_str());
-        name = getName(id);
-        xmlFree(id);
+    const string &XMLReader::reference(const char *attributeName) {
+        const string &name = getName(getAttribute(attributeName));
         read();
         return name;
     }
 
     /** Parse obligatory source tag. */
-    string XMLReader::source() {
+    const string &XMLReader::source() {
         if (begin(TAG_SOURCE, false))
             return reference("ref");
         throw std::runtime_error("Missing source element");
     }
 
     /** Parse obligatory target tag. */
-    string XMLReader::target() {
+    const string &XMLReader::target() {
         if (begin(TAG_TARGET, false))
             return reference("ref");
         throw std::runtime_error("Missing target element");
     }
 
     /** Parse obligatory anchor tag for update. */
-    string XMLReader::anchor() {
+    const string &XMLReader::anchor() {
         if (begin(TAG_ANCHOR, false))
             return reference("instanceid");
         throw std::runtime_error("Missing anchor element");
@@ -1049,7 +1350,7 @@ namespace UTAP {
     vector<char*> XMLReader::anchors() {
         vector<char*> names;
         while (begin(TAG_ANCHOR, false)) {
-            string name = reference("instanceid");
+            const string &name = reference("instanceid");
             names.push_back(const_cast<char*> (name.c_str()));
         }
 
@@ -1121,7 +1422,7 @@ namespace UTAP {
         string t_name;
 
         if (begin(TAG_TEMPLATE)) {
-            string t_path = path.get(TAG_TEMPLATE);
+            const string &t_path = path.get(TAG_TEMPLATE);
             read();
             try {
                 /* Get the name and the parameters of the template.
@@ -1155,6 +1456,7 @@ namespace UTAP {
             } catch (TypeException &e) {
                 parser->handleError(e.what());
             }
+            clearNames();
 
             return true;
         }
@@ -1166,7 +1468,7 @@ namespace UTAP {
         string t_name;
 
         if (begin(TAG_LSC)) {
-            string t_path = path.get(TAG_LSC);
+            const string &t_path = path.get(TAG_LSC);
             read();
             try {
                 /* Get the name and the parameters of the template.
@@ -1211,6 +1513,7 @@ namespace UTAP {
             } catch (TypeException &e) {
                 parser->handleError(e.what());
             }
+            clearNames();
             return true;
         }
         return false;
@@ -1218,13 +1521,9 @@ namespace UTAP {
 
     /** Parse optional instantiation tag. */
     bool XMLReader::instantiation() {
-        if (begin(TAG_INSTANTIATION, false)) {
-            const xmlChar *text = (const xmlChar*) "";
-            read();
-            if (getNodeType() == XML_READER_TYPE_TEXT) {
-                text = xmlTextReaderConstValue(reader);
-            }
-            parse(text, S_INST);
+        string text, xpath;
+        if (section(TAG_INSTANTIATION, text, xpath)) {
+            parse(text, S_INST, xpath);
             return true;
         }
         return false;
@@ -1232,19 +1531,120 @@ namespace UTAP {
 
     /** Parse optional system tag. */
     void XMLReader::system() {
-        if (begin(TAG_SYSTEM, false)) {
-            const xmlChar *text = (const xmlChar*) "";
-            read();
-            if (getNodeType() == XML_READER_TYPE_TEXT) {
-                text = xmlTextReaderConstValue(reader);
+        string text, xpath;
+        if (section(TAG_SYSTEM, text, xpath)) {
+            parse(text, S_SYSTEM, xpath);
+            endSystem();
+        } else {
+            missingSystem();
+        }
+    }
+
+    /** Read until the end of the system tag. */
+    void XMLReader::endSystem() {
+        while (!end(TAG_SYSTEM)) read();
+    }
+
+    /** Report that the document has no system tag. */
+    void XMLReader::missingSystem() {
+        PositionTracker::setPath(parser, path.get(nta ? TAG_NTA : TAG_PROJECT));
+        PositionTracker::increment(parser, 1);
+        parser->handleError("$Missing_system_tag");
+    }
+
+    /**
+     * Sets aside an optional template (or LSC template) element with
+     * the given tag. The element is copied to a document of its own
+     * and can be built later with buildTemplate().
+     */
+    bool XMLReader::deferTemplate(tag_t tag) {
+        if (begin(tag)) {
+            xmlNodePtr node = xmlTextReaderExpand(reader);
+            if (node == NULL) {
+                throw std::runtime_error("Invalid XML document");
+            }
+            deferred.push_back(deferred_t());
+            deferred_t &templ = deferred.back();
+            templ.tag = tag;
+            templ.path = path.before();
+            templ.doc = xmlNewDoc((const xmlChar*) "1.0");
+
+            xmlNodePtr copy = xmlDocCopyNode(node, templ.doc, 1);
+            xmlDocSetRootElement(templ.doc, copy);
+
+            /* Get the name of the template.
+             */
+            for (node = copy->children; node != NULL; node = node->next) {
+                if (node->type == XML_ELEMENT_NODE) {
+                    if (xmlStrcmp(node->name, (const xmlChar*) "name") == 0) {
+                        xmlChar *text = xmlNodeGetContent(node);
+                        try {
+                            templ.name = symbol((const char*) text);
+                        } catch (const char *str) {
+                        }
+                        xmlFree(text);
+                    }
+                    break;
+                }
+            }
+            skip();
+            return true;
+        }
+        return false;
+    }
+
+    /** Parse a template set aside by deferTemplate(). */
+    void XMLReader::buildTemplate(const deferred_t &templ) {
+        xmlTextReaderPtr walker = xmlReaderWalker(templ.doc);
+        if (walker == NULL) {
+            throw std::runtime_error("Invalid XML document");
+        }
+        XMLReader reader(walker, parser, newxta,
+                         skipLayout ? XML_SKIP_LAYOUT : XML_NO_OPTIONS,
+                         templ.path);
+        if (templ.tag == TAG_TEMPLATE) {
+            reader.templ();
+        } else {
+            reader.lscTempl();
+        }
+    }
+
+    /**
+     * Parse the templates, the instantiation and the system tag,
+     * building only the templates reachable from the instantiation
+     * and system declarations. Since these come after the templates,
+     * the templates are set aside until the system tag has been read.
+     */
+    void XMLReader::lazyTemplates() {
+        while (deferTemplate(TAG_TEMPLATE));
+        while (deferTemplate(TAG_LSC));
+
+        string inst, instPath, sys, sysPath;
+        bool hasInst = section(TAG_INSTANTIATION, inst, instPath);
+        bool hasSystem = section(TAG_SYSTEM, sys, sysPath);
+
+        /* Templates spawned by or referring to reachable templates
+         * are reachable too.
+         */
+        Reachability reachable(deferred);
+        reachable.text(inst.c_str());
+        reachable.text(sys.c_str());
+        reachable.close(deferred);
+
+        for (size_t i = 0; i < deferred.size(); i++) {
+            if (reachable.contains(i)) {
+                buildTemplate(deferred[i]);
             }
-            parse(text, S_SYSTEM);
-            while (!end(TAG_SYSTEM)) read();
+        }
+
+        if (hasInst) {
+            parse(inst, S_INST, instPath);
+        }
+        if (hasSystem) {
+            parse(sys, S_SYSTEM, sysPath);
+            endSystem();
         } else {
-            string s = (nta) ? path.get(TAG_NTA) : path.get(TAG_PROJECT);
-            PositionTracker::setPath(parser, s);
-            PositionTracker::increment(parser, 1);
-            parser->handleError("$Missing_system_tag");
+            missingSystem();
         }
     }
 
@@ -1273,7 +1673,7 @@ namespace UTAP {
     bool XMLReader::formula(){
         if (begin(TAG_FORMULA, false)){
             read();
-            string xpath = path.get(TAG_FORMULA);
+            const string &xpath = path.get(TAG_FORMULA);
             parser->queryFormula((const char*)xmlTextReaderConstValue(reader),
                                  xpath.c_str());
             return true;
@@ -1307,10 +1707,14 @@ namespace UTAP {
             nta = (begin(TAG_NTA)) ? true : false;
             read();
             declaration();
-            while (templ());
-            while (lscTempl());
-            instantiation();
-            system();
+            if (lazy) {
+                lazyTemplates();
+            } else {
+                while (templ());
+                while (lscTempl());
+                instantiation();
+                system();
+            }
             read(); // look ahead one tag
             if ((nta && !end(TAG_NTA)) || (!nta && !end(TAG_PROJECT)))
                 queries();
@@ -1322,45 +1726,63 @@ namespace UTAP {
 
 using namespace UTAP;
 
-int32_t parseXMLFile(const char *filename, ParserBuilder *pb, bool newxta)
+/** Read callback feeding an InputStream to libxml2. */
+static int readInput(void *context, char *buffer, int len) {
+    try {
+        return ((InputStream*) context)->read(buffer, len);
+    } catch (std::runtime_error &) {
+        return -1;
+    }
+}
+
+int32_t parseXMLFile(const char *filename, ParserBuilder *pb, bool newxta,
+                     int options)
 {
-    xmlTextReaderPtr reader = xmlReaderForFile(filename, "", 
-            XML_PARSE_NOCDATA | XML_PARSE_NOBLANKS | XML_PARSE_HUGE | XML_PARSE_RECOVER);
-    if (reader == NULL) {
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) {
         return -1;
     }
-    XMLReader(reader, pb, newxta).project();
-    return 0;
+    Statistics::Phase phase(Statistics::XML_READING);
+    int32_t res = -1;
+    try {
+        /* The file is read through an input stream, such that
+         * compressed files are decoded while they are parsed.
+         */
+        InputStream input(file);
+        xmlTextReaderPtr reader = xmlReaderForIO(readInput, NULL, &input, filename, NULL,
+                XML_PARSE_NOCDATA | XML_PARSE_NOBLANKS | XML_PARSE_HUGE | XML_PARSE_RECOVER);
+        if (reader != NULL) {
+            XMLReader(reader, pb, newxta, options).project();
+            res = 0;
+        }
+    } catch (...) {
+        fclose(file);
+        throw;
+    }
+    fclose(file);
+    return res;
 }
 
-int32_t parseXMLBuffer(const char *buffer, ParserBuilder *pb, bool newxta) {
+int32_t parseXMLBuffer(const char *buffer, ParserBuilder *pb, bool newxta,
+                       int options) {
+    Statistics::Phase phase(Statistics::XML_READING);
     size_t length = strlen(buffer);
     xmlTextReaderPtr reader = xmlReaderForMemory(buffer, length, "", "", 
             XML_PARSE_NOCDATA | XML_PARSE_HUGE | XML_PARSE_RECOVER);
     if (reader == NULL) {
         return -1;
     }
-    XMLReader(reader, pb, newxta).project();
+    XMLReader(reader, pb, newxta, options).project();
     return 0;
 }
 
 /**
- * Get the contents of the XML element with the specified path
- * @param xmlDocPtr - The XML document.
- * @param pos - The position path
- * @return res - The contents 
- */    
-string getXMLElement(xmlDocPtr docPtr, const string &path) {    
-   
+ * Get the contents of the first XML element at the specified path
+ * using the given XPath context of the document.
+ */
+static string getXMLElement(xmlDocPtr docPtr, xmlXPathContextPtr context,
+                            const string &path) {
     string res;
-    
-    // Get the context 
-    xmlXPathContextPtr context = xmlXPathNewContext(docPtr);
-    if(context == NULL) {
-        xmlFreeDoc(docPtr);
-        return res;
-    }
-    
     xmlXPathObjectPtr result = xmlXPathEvalExpression((xmlChar*)path.c_str(), context);
     if(result!=NULL) {
         xmlNodeSetPtr nodeset = result->nodesetval;
@@ -1375,6 +1797,26 @@ string getXMLElement(xmlDocPtr docPtr, const string &path) {
         }
         xmlXPathFreeObject(result);
     }
+    return res;
+}
+
+/**
+ * Get the contents of the XML element with the specified path
+ * @param xmlDocPtr - The XML document.
+ * @param pos - The position path
+ * @return res - The contents 
+ */    
+string getXMLElement(xmlDocPtr docPtr, const string &path) {    
+   
+    string res;
+    
+    // Get the context 
+    xmlXPathContextPtr context = xmlXPathNewContext(docPtr);
+    if(context == NULL) {
+        return res;
+    }
+    
+    res = getXMLElement(docPtr, context, path);
     
     xmlXPathFreeContext(context);
     
@@ -1388,13 +1830,33 @@ string getXMLElement(xmlDocPtr docPtr, const string &path) {
  * @return res - The contents 
  */
 string getXMLElement(const char *xmlBuffer, const string &path) {
-    xmlDocPtr docPtr = xmlParseMemory(xmlBuffer, strlen(xmlBuffer));
-    if(docPtr) {    
-        string res = getXMLElement(docPtr,path);
-        xmlFreeDoc(docPtr);
-        return res;
+    return XMLDocument(xmlBuffer).getElement(path);
+}
+
+XMLDocument::XMLDocument(const char *buffer)
+    : doc(xmlParseMemory(buffer, strlen(buffer))), context(NULL) {
+    if (doc) {
+        context = xmlXPathNewContext(doc);
     }
-    else {
-        return "";
+}
+
+XMLDocument::~XMLDocument() {
+    if (context) {
+        xmlXPathFreeContext(context);
+    }
+    if (doc) {
+        xmlFreeDoc(doc);
+    }
+}
+
+const string &XMLDocument::getElement(const string &path) {
+    std::unordered_map<string, string>::iterator it = elements.find(path);
+    if (it == elements.end()) {
+        string res;
+        if (context) {
+            res = getXMLElement(doc, context, path);
+        }
+        it = elements.insert(std::make_pair(path, res)).first;
     }
+    return it->second;
 }
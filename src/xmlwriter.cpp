@@ -21,6 +21,8 @@
 
 #include "utap/xmlwriter.h"
 #include <cstring>
+#include <cerrno>
+#include <unistd.h>
 
 using std::vector;
 using std::list;
@@ -48,8 +50,47 @@ string UTAP::concatDouble(const string& s, double i) {
     return o.str();
 }
 
-XMLWriter::XMLWriter(xmlTextWriterPtr writer, TimedAutomataSystem* taSystem)
-: writer(writer), taSystem(taSystem) {
+namespace
+{
+    /**
+     * Stream buffer writing to the text of the current element of an
+     * xmlTextWriter a block at a time, such that generated text need
+     * not be collected in a string first.
+     */
+    class TextBuffer: public std::streambuf
+    {
+        xmlTextWriterPtr writer;
+        char buffer[4096];
+    public:
+        TextBuffer(xmlTextWriterPtr writer): writer(writer) {
+            setp(buffer, buffer + sizeof(buffer) - 1); // room for '\0'
+        }
+    protected:
+        int overflow(int c) {
+            if (sync() < 0) {
+                return traits_type::eof();
+            }
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(c);
+                pbump(1);
+            }
+            return traits_type::not_eof(c);
+        }
+
+        int sync() {
+            if (pptr() == pbase()) {
+                return 0;
+            }
+            *pptr() = '\0';
+            setp(buffer, buffer + sizeof(buffer) - 1);
+            return xmlTextWriterWriteString(writer, BAD_CAST buffer) < 0 ? -1 : 0;
+        }
+    };
+}
+
+XMLWriter::XMLWriter(xmlTextWriterPtr writer, TimedAutomataSystem* taSystem,
+                     int options)
+: writer(writer), taSystem(taSystem), indent(!(options & XML_NO_INDENT)) {
 }
 
 XMLWriter::~XMLWriter() {
@@ -60,7 +101,7 @@ XMLWriter::~XMLWriter() {
  * as child of the current element or
  * as root (if it's the first element)*/
 void XMLWriter::startElement(const char* element) {
-    if (xmlTextWriterStartElement(writer, xmlCharStrdup(element)) < 0) {
+    if (xmlTextWriterStartElement(writer, BAD_CAST element) < 0) {
         throw std::runtime_error("Error at xmlTextWriterStartElement");
     }
 }
@@ -75,15 +116,14 @@ void XMLWriter::endElement() {
 /* Writes an element named "name", with the content
  * "content" as child of the current element. */
 void XMLWriter::writeElement(const char* name, const char* content) {
-    if (xmlTextWriterWriteElement(writer, xmlCharStrdup(name),
-            xmlCharStrdup(content)) < 0) {
+    if (xmlTextWriterWriteElement(writer, BAD_CAST name, BAD_CAST content) < 0) {
         throw std::runtime_error("Error at xmlTextWriterWriteElement");
     }
 }
 
 /* Writes a String in the current element. */
 void XMLWriter::writeString(const char* data) {
-    if (xmlTextWriterWriteString(writer, xmlCharStrdup(data)) < 0) {
+    if (xmlTextWriterWriteString(writer, BAD_CAST data) < 0) {
         throw std::runtime_error("Error at xmlTextWriterWriteString");
     }
 }
@@ -98,19 +138,39 @@ void XMLWriter::xmlwriteString(const xmlChar* data) {
 /* Adds an attribute with name "name" and value "value"
  * to the current element. */
 void XMLWriter::writeAttribute(const char* name, const char* value) {
-    if (xmlTextWriterWriteAttribute(writer, xmlCharStrdup(name),
-            xmlCharStrdup(value)) < 0) {
+    if (xmlTextWriterWriteAttribute(writer, BAD_CAST name, BAD_CAST value) < 0) {
         throw std::runtime_error("Error at xmlTextWriterWriteAttribute");
     }
 }
 
+/* Adds an attribute with name "name" and the value "prefix"
+ * followed by the number "value" to the current element. */
+void XMLWriter::writeAttribute(const char* name, int value, const char* prefix) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%s%d", prefix, value);
+    writeAttribute(name, buffer);
+}
+
+/* Writes an element named "name" with the given declarations
+ * as content. */
+void XMLWriter::writeDeclarations(const char* name, const declarations_t& decls,
+                                  bool global) {
+    startElement(name);
+    TextBuffer buffer(writer);
+    std::ostream os(&buffer);
+    decls.write(os, global);
+    if (global) {
+        os << "\n" << getChanPriority() << " ";
+    }
+    if (!os.flush()) {
+        throw std::runtime_error("Error at xmlTextWriterWriteString");
+    }
+    endElement();
+}
+
 /** Parses optional declaration. */
 void XMLWriter::declaration() {
-    string globalDeclarations = taSystem->getGlobals().toString(true);
-    globalDeclarations += "\n";
-    globalDeclarations += getChanPriority();
-    globalDeclarations += " ";
-    writeElement("declaration", globalDeclarations.c_str());
+    writeDeclarations("declaration", taSystem->getGlobals(), true);
 }
 
 string XMLWriter::getChanPriority() const {
@@ -129,40 +189,34 @@ string XMLWriter::getChanPriority() const {
 
 /* writes a "label" element with the "kind", "x" and "y" attributes
  * an with the "data" content. */
-void XMLWriter::label(const char* kind, string data, int x, int y) {
+void XMLWriter::label(const char* kind, const string& data, int x, int y) {
     if (data == "1") {
         return;
     }
-    if (data.substr(0, 5) == "1 && ") {
-        data = data.substr(5, data.size() - 5);
-    }
-    xmlChar * tmp = ConvertInput(data.c_str(), MY_ENCODING);
-    if (tmp == NULL) {
-        return;
+    const char* text = data.c_str();
+    if (data.compare(0, 5, "1 && ") == 0) {
+        text += 5;
     }
     startElement("label");
     writeAttribute("kind", kind);
-    writeAttribute("x", concat("", x).c_str());
-    writeAttribute("y", concat("", y).c_str());
-    xmlwriteString(tmp);
-    xmlFree(tmp);
+    writeAttribute("x", x);
+    writeAttribute("y", y);
+    writeString(text);
     endElement();
 }
 
 void XMLWriter::name(const state_t& state, int x, int y) {
-    const char* name = state.uid.getName().c_str();
     startElement("name");
-    writeAttribute("x", concat("", x).c_str());
-    writeAttribute("y", concat("", y).c_str());
-    writeString(name);
+    writeAttribute("x", x);
+    writeAttribute("y", y);
+    writeString(state.uid.getName().c_str());
     endElement();
 }
 
 void XMLWriter::writeStateAttributes(const state_t& state, int x, int y) {
-    int32_t id = state.locNr;
-    writeAttribute("id", concat("id", id).c_str());
-    writeAttribute("x", concat("", x).c_str());
-    writeAttribute("y", concat("", y).c_str());
+    writeAttribute("id", state.locNr, "id");
+    writeAttribute("x", x);
+    writeAttribute("y", y);
 }
 
 /* writes a location */
@@ -179,8 +233,7 @@ void XMLWriter::location(const state_t& state) {
     name(state, x + 8, y + 8);
     // invariant
     if (!state.invariant.empty()) {
-        const char* invariant = state.invariant.toString().c_str();
-        label("invariant", invariant, x + 8, y + 24);
+        label("invariant", state.invariant.toString(), x + 8, y + 24);
     }
     // "committed" or "urgent" element
     if (state.uid.getType().is(COMMITTED)) {
@@ -197,16 +250,15 @@ void XMLWriter::location(const state_t& state) {
 void XMLWriter::init(const template_t& templ) {
     int id = static_cast<const state_t*> (templ.init.getData())->locNr;
     startElement("init");
-    writeAttribute("ref", concat("id", id).c_str());
+    writeAttribute("ref", id, "id");
     endElement();
 }
 
 /* writes the source of the given edge */
 int XMLWriter::source(const edge_t& edge) {
     int loc = edge.src->locNr;
-    const char* id = concat("id", loc).c_str();
     startElement("source");
-    writeAttribute("ref", id);
+    writeAttribute("ref", loc, "id");
     endElement();
     return loc;
 }
@@ -214,9 +266,8 @@ int XMLWriter::source(const edge_t& edge) {
 /* writes the target of the given edge */
 int XMLWriter::target(const edge_t& edge) {
     int loc = edge.dst->locNr;
-    const char* id = concat("id", loc).c_str();
     startElement("target");
-    writeAttribute("ref", id);
+    writeAttribute("ref", loc, "id");
     endElement();
     return loc;
 }
@@ -240,8 +291,8 @@ void XMLWriter::selfLoop(int loc, float initialAngle, const edge_t& edge) { // f
 
 void XMLWriter::nail(int x, int y) {
     startElement("nail");
-    writeAttribute("x", concat("", x).c_str());
-    writeAttribute("y", concat("", y).c_str());
+    writeAttribute("x", x);
+    writeAttribute("y", y);
     endElement();
 }
 
@@ -291,14 +342,10 @@ void XMLWriter::taTempl(const template_t& templ) {
         return;
     }
     selfLoops.clear();
-    string name = templ.uid.getName();
-    string parameters = templ.writeParameters();
-    string declarations = templ.toString(false);
-
     startElement("template");
-    writeElement("name", name.c_str());
-    writeElement("parameter", parameters.c_str());
-    writeElement("declaration", declarations.c_str());
+    writeElement("name", templ.uid.getName().c_str());
+    writeElement("parameter", templ.writeParameters().c_str());
+    writeDeclarations("declaration", templ, false);
 
     //locations
     std::deque<state_t>::const_iterator s_itr;
@@ -318,20 +365,29 @@ void XMLWriter::taTempl(const template_t& templ) {
 
 void XMLWriter::system_instantiation() { // TODO proc priority
     const std::list<instance_t>* instances = &(taSystem->getProcesses());
-    string str = "";
-    string proc = "";
     std::list<instance_t>::const_iterator itr;
+    startElement("system");
+    TextBuffer buffer(writer);
+    std::ostream os(&buffer);
     for (itr = instances->begin(); itr != instances->end(); ++itr) {
         if (itr->uid.getName() != itr->templ->uid.getName()) {
-            str += itr->uid.getName() + " = "
-                    + itr->templ->uid.getName() + "("
-                    + itr->writeArguments() + ");\n";
+            os << itr->uid.getName() << " = "
+               << itr->templ->uid.getName() << "("
+               << itr->writeArguments() << ");\n";
+        }
+    }
+    os << "system ";
+    for (itr = instances->begin(); itr != instances->end(); ++itr) {
+        if (itr != instances->begin()) {
+            os << ", ";
         }
-        proc += itr->uid.getName() + ", ";
+        os << itr->uid.getName();
     }
-    proc = proc.substr(0, proc.size() - 2);
-    str += "system " + proc + "; ";
-    writeElement("system", str.c_str());
+    os << "; ";
+    if (!os.flush()) {
+        throw std::runtime_error("Error at xmlTextWriterWriteString");
+    }
+    endElement();
 }
 
 /** Parse the project document. */
@@ -361,8 +417,10 @@ void XMLWriter::startDocument() {
     xmlTextWriterWriteDTD(writer, (xmlChar *) "nta",
             (xmlChar *) "-//Uppaal Team//DTD Flat System 1.1//EN",
             (xmlChar *) "http://www.it.uu.se/research/group/darts/uppaal/flat-1_1.dtd", NULL);
-    xmlTextWriterSetIndent(writer, 1);
-    xmlTextWriterSetIndentString(writer, (xmlChar *) "  ");
+    if (indent) {
+        xmlTextWriterSetIndent(writer, 1);
+        xmlTextWriterSetIndentString(writer, (xmlChar *) "  ");
+    }
 }
 
 void XMLWriter::endDocument() {
@@ -430,7 +488,8 @@ xmlChar * UTAP::ConvertInput(const char *in, const char *encoding) {
 using namespace UTAP;
 //#if defined(LIBXML_WRITER_ENABLED) && defined(LIBXML_OUTPUT_ENABLED)
 
-int32_t writeXMLFile(const char *filename, TimedAutomataSystem* taSystem) {
+int32_t writeXMLFile(const char *filename, TimedAutomataSystem* taSystem,
+                     int options) {
     xmlTextWriterPtr writer;
 
     /* Create a new XmlWriter for filename, with no compression. */
@@ -438,8 +497,61 @@ int32_t writeXMLFile(const char *filename, TimedAutomataSystem* taSystem) {
     if (writer == NULL) {
         throw std::runtime_error("Error creating the xml writer");
     }
-    XMLWriter(writer, taSystem).project();
+    XMLWriter(writer, taSystem, options).project();
 
     //xmlFreeTextWriter(writer);
     return 0;
 }
+
+/* Output callback appending to a string. */
+static int appendString(void *context, const char *buffer, int len) {
+    ((string*) context)->append(buffer, len);
+    return len;
+}
+
+/* Output callback writing to a file descriptor. */
+static int writeDescriptor(void *context, const char *buffer, int len) {
+    int fd = *(int*) context;
+    int written = 0;
+    while (written < len) {
+        ssize_t n = write(fd, buffer + written, len - written);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        written += n;
+    }
+    return len;
+}
+
+/* Writes the system through an output buffer, which is closed when
+ * the document has been written. */
+static int32_t writeXMLOutput(xmlOutputBufferPtr out, TimedAutomataSystem* taSystem,
+                              int options) {
+    if (out == NULL) {
+        throw std::runtime_error("Error creating the xml writer");
+    }
+    xmlTextWriterPtr writer = xmlNewTextWriter(out);
+    if (writer == NULL) {
+        xmlOutputBufferClose(out);
+        throw std::runtime_error("Error creating the xml writer");
+    }
+    XMLWriter(writer, taSystem, options).project();
+    return 0;
+}
+
+/* Writes the system to the buffer, replacing its contents. */
+int32_t writeXMLBuffer(string &buffer, TimedAutomataSystem* taSystem,
+                       int options) {
+    buffer.clear();
+    return writeXMLOutput(xmlOutputBufferCreateIO(appendString, NULL, &buffer, NULL),
+                          taSystem, options);
+}
+
+/* Writes the system to the file descriptor, which is left open. */
+int32_t writeXMLStream(int fd, TimedAutomataSystem* taSystem, int options) {
+    return writeXMLOutput(xmlOutputBufferCreateIO(writeDescriptor, NULL, &fd, NULL),
+                          taSystem, options);
+}
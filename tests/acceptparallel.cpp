@@ -0,0 +1,171 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks that TimedAutomataSystem::acceptParallel() visits a system
+ * like accept() does: a recording visitor must see the same sequence
+ * of callbacks, and the compile time computable values must be the
+ * same.
+ */
+
+#include "utap/utap.h"
+#include "utap/typechecker.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace UTAP;
+using std::string;
+using std::vector;
+using std::cerr;
+using std::endl;
+
+/**
+ * Records the callbacks together with the number of global variables
+ * visited before them, such that a worker cloned before the global
+ * declarations were visited records something different.
+ */
+class Recorder : public SystemVisitor
+{
+    size_t globals{0};
+    bool inTemplate{false};
+
+    void record(const string &event)
+    {
+        events.push_back(event + " after " + std::to_string(globals) + " globals");
+    }
+public:
+    vector<string> events;
+
+    void visitVariable(variable_t &variable) override
+    {
+        if (!inTemplate)
+        {
+            globals++;
+        }
+        record("variable " + variable.uid.getName());
+    }
+    bool visitTemplateBefore(template_t &temp) override
+    {
+        inTemplate = true;
+        record("template " + temp.uid.getName());
+        return true;
+    }
+    void visitTemplateAfter(template_t &temp) override
+    {
+        inTemplate = false;
+        record("end of template " + temp.uid.getName());
+    }
+    void visitState(state_t &state) override
+    {
+        record("state " + state.uid.getName());
+    }
+    void visitEdge(edge_t &edge) override
+    {
+        record("edge " + std::to_string(edge.nr));
+    }
+    void visitFunction(function_t &function) override
+    {
+        record("function " + function.uid.getName());
+    }
+    void visitInstance(instance_t &instance) override
+    {
+        record("instance " + instance.uid.getName());
+    }
+    void visitProcess(instance_t &process) override
+    {
+        record("process " + process.uid.getName());
+    }
+    SystemVisitor *clone() const override
+    {
+        Recorder *recorder = new Recorder(*this);
+        recorder->events.clear();
+        return recorder;
+    }
+    void reduce(SystemVisitor &worker) override
+    {
+        vector<string> &more = static_cast<Recorder&>(worker).events;
+        events.insert(events.end(), more.begin(), more.end());
+    }
+};
+
+/** Returns the number of symbols on which the two visitors differ. */
+static int compare(const CompileTimeComputableValues &a,
+                   const CompileTimeComputableValues &b, frame_t frame)
+{
+    int differences = 0;
+    for (uint32_t i = 0; i < frame.getSize(); i++)
+    {
+        if (a.contains(frame[i]) != b.contains(frame[i]))
+        {
+            cerr << "Computable values differ for " << frame[i].getName() << endl;
+            differences++;
+        }
+    }
+    return differences;
+}
+
+static int check(const string &name)
+{
+    TimedAutomataSystem system;
+    FILE *file = fopen(name.c_str(), "r");
+    if (file == NULL)
+    {
+        perror(name.c_str());
+        return 1;
+    }
+    parseXTA(file, &system, true);
+    fclose(file);
+
+    int failures = 0;
+    Recorder serial, parallel;
+    system.accept(serial);
+    system.acceptParallel(parallel, 4);
+    if (serial.events != parallel.events)
+    {
+        cerr << name << ": acceptParallel() differs from accept()" << endl;
+        failures++;
+    }
+
+    CompileTimeComputableValues serialValues, parallelValues;
+    system.accept(serialValues);
+    system.acceptParallel(parallelValues, 4);
+    failures += compare(serialValues, parallelValues, system.getGlobals().frame);
+    for (template_t &temp : system.getTemplates())
+    {
+        failures += compare(serialValues, parallelValues, temp.parameters);
+        failures += compare(serialValues, parallelValues, temp.frame);
+    }
+    return failures;
+}
+
+int main()
+{
+    const char *srcdir = getenv("srcdir");
+    string dir = srcdir ? srcdir : ".";
+    int failures = 0;
+    failures += check(dir + "/errors/diagnostics.xta");
+    failures += check(dir + "/models/overflow.xta");
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,252 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks that compressed models are parsed like the uncompressed
+ * ones: every model given on the command line is compressed with each
+ * decoder the library was configured with, parsed from the file, and
+ * written back with writeXMLBuffer(), which must give the same bytes
+ * as for the uncompressed model. Models split over several gzip
+ * members or zstd frames must be parsed the same way, and truncated
+ * files must be rejected.
+ *
+ * Model names ending in .xml are parsed as XML, all others as XTA.
+ */
+
+#include "utap/utap.h"
+
+#ifdef ENABLE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace UTAP;
+using std::string;
+using std::cerr;
+using std::endl;
+
+static const char *scratch = "compressed-model.tmp";
+
+/** The outcome of parsing a model. */
+struct result_t
+{
+    bool ok;       /**< Parsed without exceptions or errors */
+    string xml;    /**< The system written back as XML */
+};
+
+static string readFile(const string &name)
+{
+    std::ifstream file(name.c_str(), std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot read " + name);
+    }
+    std::ostringstream out;
+    out << file.rdbuf();
+    return out.str();
+}
+
+static void writeFile(const string &name, const string &data)
+{
+    std::ofstream file(name.c_str(), std::ios::binary);
+    file << data;
+    if (!file)
+    {
+        throw std::runtime_error("Cannot write " + name);
+    }
+}
+
+static result_t parse(const string &name, bool xml)
+{
+    result_t result = { false, string() };
+    TimedAutomataSystem system;
+    try
+    {
+        if (xml)
+        {
+            if (parseXMLFile(name.c_str(), &system, true) < 0)
+            {
+                return result;
+            }
+        }
+        else
+        {
+            FILE *file = fopen(name.c_str(), "rb");
+            if (file == NULL)
+            {
+                return result;
+            }
+            try
+            {
+                parseXTA(file, &system, true);
+            }
+            catch (...)
+            {
+                fclose(file);
+                throw;
+            }
+            fclose(file);
+        }
+    }
+    catch (std::exception &)
+    {
+        return result;
+    }
+    result.ok = !system.hasErrors();
+    writeXMLBuffer(result.xml, &system);
+    return result;
+}
+
+#ifdef ENABLE_ZLIB
+/** Returns \a data compressed as a single gzip member. */
+static string gzip(const string &data)
+{
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    if (deflateInit2(&z, 9, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        throw std::runtime_error("Failed to initialise gzip encoder");
+    }
+    string out(deflateBound(&z, data.size()), '\0');
+    z.next_in = (Bytef *)data.data();
+    z.avail_in = data.size();
+    z.next_out = (Bytef *)&out[0];
+    z.avail_out = out.size();
+    int ret = deflate(&z, Z_FINISH);
+    out.resize(out.size() - z.avail_out);
+    deflateEnd(&z);
+    if (ret != Z_STREAM_END)
+    {
+        throw std::runtime_error("Failed to gzip compress");
+    }
+    return out;
+}
+#endif
+
+#ifdef ENABLE_ZSTD
+/** Returns \a data compressed as a single zstd frame. */
+static string zstd(const string &data)
+{
+    string out(ZSTD_compressBound(data.size()), '\0');
+    size_t size = ZSTD_compress(&out[0], out.size(), data.data(), data.size(), 3);
+    if (ZSTD_isError(size))
+    {
+        throw std::runtime_error("Failed to zstd compress");
+    }
+    out.resize(size);
+    return out;
+}
+#endif
+
+static int failures = 0;
+
+/**
+ * Parses \a data written to a file and compares the result with the
+ * \a expected result, or checks that it is rejected.
+ */
+static void check(const string &model, const char *what, const string &data,
+                  bool xml, const result_t *expected)
+{
+    writeFile(scratch, data);
+    result_t result = parse(scratch, xml);
+    if (expected == NULL)
+    {
+        if (result.ok)
+        {
+            cerr << "FAIL: " << model << ": " << what << " input was accepted" << endl;
+            failures++;
+        }
+    }
+    else if (!result.ok)
+    {
+        cerr << "FAIL: " << model << ": " << what << " input was rejected" << endl;
+        failures++;
+    }
+    else if (result.xml != expected->xml)
+    {
+        cerr << "FAIL: " << model << ": " << what
+             << " input gives a different system" << endl;
+        failures++;
+    }
+}
+
+/** Returns \a data compressed in two parts by \a compress. */
+template<class F>
+static string split(F compress, const string &data)
+{
+    size_t half = data.size() / 2;
+    return compress(data.substr(0, half)) + compress(data.substr(half));
+}
+
+/** Returns \a data without the second half. */
+static string truncate(const string &data)
+{
+    return data.substr(0, data.size() / 2);
+}
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            string model = argv[i];
+            bool xml = model.size() >= 4
+                && model.compare(model.size() - 4, 4, ".xml") == 0;
+            string plain = readFile(model);
+            result_t expected = parse(model, xml);
+            if (!expected.ok)
+            {
+                cerr << "FAIL: " << model << " has errors" << endl;
+                failures++;
+                continue;
+            }
+#ifdef ENABLE_ZLIB
+            check(model, "gzip", gzip(plain), xml, &expected);
+            check(model, "multi-member gzip", split(gzip, plain), xml, &expected);
+            check(model, "truncated gzip", truncate(gzip(plain)), xml, NULL);
+#endif
+#ifdef ENABLE_ZSTD
+            check(model, "zstd", zstd(plain), xml, &expected);
+            check(model, "multi-frame zstd", split(zstd, plain), xml, &expected);
+            check(model, "truncated zstd", truncate(zstd(plain)), xml, NULL);
+#endif
+        }
+    }
+    catch (std::exception &e)
+    {
+        cerr << "FAIL: " << e.what() << endl;
+        failures++;
+    }
+    remove(scratch);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,13 @@
+#!/bin/sh
+# Checks that gzip and zstd compressed models, including models split
+# over several members or frames, are parsed like the uncompressed
+# models, and that truncated files are rejected. The generated models
+# are larger than the blocks in which compressed files are read.
+
+status=0
+"$MODELGEN" -s 1 -t 16 -p 64 -F 16 -C 4 -q 4 -L 4 compressed-model.xml || exit 1
+"$MODELGEN" -f xta -s 1 -t 16 -p 64 -F 16 -C 4 compressed-model.xta || exit 1
+./compressed compressed-model.xml compressed-model.xta "$srcdir"/models/*.xta \
+    || status=1
+rm -f compressed-model.xml compressed-model.xta
+exit $status
@@ -0,0 +1,151 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks that a copy of a system is equivalent to the system: for
+ * every model given on the command line, a copy of the parsed system
+ * must write the same XML and give the same errors and warnings when
+ * type checked as the system parsed again, also after the copied
+ * system has been destroyed. The same must hold for a copy of a type
+ * checked system.
+ *
+ * Model names ending in .xml are parsed as XML, all others as XTA.
+ */
+
+#include "utap/utap.h"
+#include "utap/typechecker.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace UTAP;
+using std::string;
+using std::vector;
+using std::cerr;
+using std::endl;
+
+static int failures = 0;
+
+static void parse(const string &name, TimedAutomataSystem &system)
+{
+    if (name.size() >= 4 && name.compare(name.size() - 4, 4, ".xml") == 0)
+    {
+        parseXMLFile(name.c_str(), &system, true);
+    }
+    else
+    {
+        FILE *file = fopen(name.c_str(), "r");
+        if (file == NULL)
+        {
+            perror(name.c_str());
+            exit(EXIT_FAILURE);
+        }
+        parseXTA(file, &system, true);
+        fclose(file);
+    }
+}
+
+static void typeCheck(TimedAutomataSystem &system)
+{
+    TypeChecker checker(&system);
+    system.accept(checker);
+}
+
+/** Returns the errors and warnings of the system as text. */
+static vector<string> diagnostics(const TimedAutomataSystem &system)
+{
+    vector<string> result;
+    for (const UTAP::error_t &e: system.getErrors())
+    {
+        std::ostringstream out;
+        out << "error: " << e << " " << e.context;
+        result.push_back(out.str());
+    }
+    for (const UTAP::error_t &w: system.getWarnings())
+    {
+        std::ostringstream out;
+        out << "warning: " << w << " " << w.context;
+        result.push_back(out.str());
+    }
+    return result;
+}
+
+static string write(TimedAutomataSystem &system)
+{
+    string buffer;
+    writeXMLBuffer(buffer, &system);
+    return buffer;
+}
+
+/** Compares the copy with the reference system. */
+static void compare(const string &model, const char *what,
+                    TimedAutomataSystem &copy, TimedAutomataSystem &reference)
+{
+    if (write(copy) != write(reference))
+    {
+        cerr << "FAIL: " << model << ": " << what << " writes differently" << endl;
+        failures++;
+    }
+    if (diagnostics(copy) != diagnostics(reference))
+    {
+        cerr << "FAIL: " << model << ": " << what
+             << " has different errors or warnings" << endl;
+        failures++;
+    }
+}
+
+static void check(const string &model)
+{
+    TimedAutomataSystem reference;
+    parse(model, reference);
+
+    // Copy a parsed system, and type check the copy
+    std::unique_ptr<TimedAutomataSystem> original(new TimedAutomataSystem());
+    parse(model, *original);
+    TimedAutomataSystem copy(*original);
+    original.reset();
+    compare(model, "copy of parsed system", copy, reference);
+    typeCheck(copy);
+    typeCheck(reference);
+    compare(model, "type checked copy", copy, reference);
+
+    // Copy a type checked system
+    original.reset(new TimedAutomataSystem());
+    parse(model, *original);
+    typeCheck(*original);
+    TimedAutomataSystem checked(*original);
+    original.reset();
+    compare(model, "copy of type checked system", checked, reference);
+}
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        check(argv[i]);
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,11 @@
+#!/bin/sh
+# Checks that copies of systems are equivalent to the systems they
+# were copied from.
+
+status=0
+"$MODELGEN" -s 1 -t 16 -p 64 -F 16 -C 4 -q 4 -L 4 copysystem-model.xml || exit 1
+"$MODELGEN" -f xta -s 2 -t 8 -p 32 -F 8 -C 4 copysystem-model.xta || exit 1
+./copysystem copysystem-model.xml copysystem-model.xta \
+    "$srcdir"/models/*.xta "$srcdir"/errors/*.xta || status=1
+rm -f copysystem-model.xml copysystem-model.xta
+exit $status
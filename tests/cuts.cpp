@@ -0,0 +1,84 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks the membership, equality and hashing of cut_t, including
+ * simregions which have not been numbered.
+ */
+
+#include "utap/system.h"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace UTAP;
+using std::cerr;
+using std::endl;
+
+static int failures = 0;
+
+static void expect(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        cerr << "FAIL: " << what << endl;
+        failures++;
+    }
+}
+
+static simregion_t simregion(int nr)
+{
+    simregion_t s;
+    s.nr = nr;
+    return s;
+}
+
+int main()
+{
+    cut_t cut(0);
+    simregion_t unnumbered;
+    cut.add(unnumbered);
+    expect(!cut.contains(unnumbered), "unnumbered simregion is in the cut");
+    expect(cut.getSimregions().empty(), "unnumbered simregion was added");
+    expect(cut == cut_t(1), "unnumbered simregion changed the cut");
+    cut.erase(unnumbered);
+
+    cut.add(simregion(0));
+    cut.add(simregion(70));
+    cut.add(simregion(70));
+    expect(cut.contains(simregion(0)), "simregion 0 is not in the cut");
+    expect(cut.contains(simregion(70)), "simregion 70 is not in the cut");
+    expect(!cut.contains(simregion(6)), "simregion 6 is in the cut");
+    expect(!cut.contains(simregion(134)), "simregion 134 is in the cut");
+    expect(cut.getSimregions().size() == 2, "simregion 70 was added twice");
+
+    cut_t other(1);
+    other.add(simregion(70));
+    expect(!(cut == other), "cuts with different simregions are equal");
+    cut.erase(simregion(0));
+    expect(cut == other, "cuts with the same simregions differ");
+    expect(cut.hash() == other.hash(), "equal cuts hash differently");
+    expect(cut.getSimregions().size() == 1, "simregion 0 was not erased");
+
+    cut.erase(simregion(70));
+    expect(cut == cut_t(2), "cut is not empty after erasing everything");
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,143 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks the edges of locations and branchpoints returned by
+ * template_t against the edges of the template, also when locations,
+ * branchpoints and edges are added after the template was parsed, and
+ * that nodes which are not part of the template have no edges.
+ */
+
+#include "utap/utap.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace UTAP;
+using std::string;
+using std::vector;
+using std::cerr;
+using std::endl;
+
+static const char *model =
+    "process P() {\n"
+    "state A, B, C, D;\n"
+    "init A;\n"
+    "trans A -> B {}, B -> A {}, A -> C {}, C -> C {}, B -> C {}, A -> B {};\n"
+    "}\n"
+    "system P;\n";
+
+static int failures = 0;
+
+static void expect(bool condition, const string &what)
+{
+    if (!condition)
+    {
+        cerr << "FAIL: " << what << endl;
+        failures++;
+    }
+}
+
+/** Returns the indices of the edges in the range. */
+static vector<uint32_t> indices(const edge_range_t &range)
+{
+    vector<uint32_t> result;
+    for (auto i = range.begin(); i != range.end(); ++i)
+    {
+        result.push_back(i.getIndex());
+    }
+    return result;
+}
+
+/** Checks the edges of every node against a scan of all edges. */
+static void check(template_t &t, const char *when)
+{
+    for (auto& s: t.states)
+    {
+        vector<uint32_t> out, in;
+        for (uint32_t i = 0; i < t.edges.size(); i++)
+        {
+            if (t.edges[i].src == &s)
+                out.push_back(i);
+            if (t.edges[i].dst == &s)
+                in.push_back(i);
+        }
+        string name = s.uid.getName();
+        expect(indices(t.getOutgoingEdges(s)) == out,
+               string(when) + ": outgoing edges of " + name);
+        expect(indices(t.getIncomingEdges(s)) == in,
+               string(when) + ": incoming edges of " + name);
+    }
+    for (auto& b: t.branchpoints)
+    {
+        vector<uint32_t> out, in;
+        for (uint32_t i = 0; i < t.edges.size(); i++)
+        {
+            if (t.edges[i].srcb == &b)
+                out.push_back(i);
+            if (t.edges[i].dstb == &b)
+                in.push_back(i);
+        }
+        string name = b.uid.getName();
+        expect(indices(t.getOutgoingEdges(b)) == out,
+               string(when) + ": outgoing edges of " + name);
+        expect(indices(t.getIncomingEdges(b)) == in,
+               string(when) + ": incoming edges of " + name);
+    }
+}
+
+int main()
+{
+    TimedAutomataSystem system;
+    parseXTA(model, &system, true);
+    if (system.hasErrors() || system.getTemplates().size() != 1)
+    {
+        cerr << "FAIL: model has errors" << endl;
+        return EXIT_FAILURE;
+    }
+    template_t &t = system.getTemplates().front();
+    check(t, "parsed");
+    expect(t.getOutgoingEdges(t.states[3]).empty(), "D has outgoing edges");
+
+    // Nodes which are not in the template
+    state_t state;
+    state.locNr = -1;
+    expect(t.getOutgoingEdges(state).empty(), "location -1 has edges");
+    state.locNr = 100;
+    expect(t.getIncomingEdges(state).empty(), "location 100 has edges");
+    branchpoint_t branchpoint;
+    branchpoint.bpNr = 0;
+    expect(t.getOutgoingEdges(branchpoint).empty(), "branchpoint 0 has edges");
+
+    // Edges added after parsing, also to new nodes
+    t.addEdge(t.states[3].uid, t.states[0].uid, true, "");
+    check(t, "after adding an edge");
+    state_t &e = t.addLocation("E", expression_t(), expression_t());
+    branchpoint_t &f = t.addBranchpoint("F");
+    t.addEdge(t.states[1].uid, f.uid, true, "");
+    t.addEdge(f.uid, e.uid, true, "");
+    t.addEdge(f.uid, t.states[2].uid, true, "");
+    check(t, "after adding nodes");
+    expect(t.getOutgoingEdges(f).size() == 2, "F has the wrong edges");
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,45 @@
+#!/bin/sh
+# Checks that syntaxcheck accepts every model in models/ without
+# errors or warnings, and reports the diagnostics in the .out file
+# next to every model in errors/. XML models are also checked with
+# the layout skipped (syntaxcheck -l), which must not change the
+# diagnostics.
+
+status=0
+for model in "$srcdir"/models/*.xta "$srcdir"/models/*.xml; do
+    [ -f "$model" ] || continue
+    if ! "$SYNTAXCHECK" "$model"; then
+        echo "FAIL: $model" >&2
+        status=1
+    fi
+    case "$model" in
+        *.xml)
+            if ! "$SYNTAXCHECK" -l "$model"; then
+                echo "FAIL: $model without layout" >&2
+                status=1
+            fi
+            ;;
+    esac
+done
+for model in "$srcdir"/errors/*.xta "$srcdir"/errors/*.xml; do
+    [ -f "$model" ] || continue
+    expected="${model%.*}.out"
+    "$SYNTAXCHECK" "$model" >models.out 2>&1
+    if ! cmp -s "$expected" models.out; then
+        echo "FAIL: $model" >&2
+        diff "$expected" models.out >&2
+        status=1
+    fi
+    case "$model" in
+        *.xml)
+            "$SYNTAXCHECK" -l "$model" >models.out 2>&1
+            if ! cmp -s "$expected" models.out; then
+                echo "FAIL: $model without layout" >&2
+                diff "$expected" models.out >&2
+                status=1
+            fi
+            ;;
+    esac
+done
+rm -f models.out
+exit $status
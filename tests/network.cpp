@@ -0,0 +1,155 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks the network of the processes of a system: for every model
+ * given on the command line, the locations, edges and expressions of
+ * every process in the network must be those of its template, in the
+ * order of the template and numbered consecutively.
+ *
+ * Model names ending in .xml are parsed as XML, all others as XTA.
+ */
+
+#include "utap/utap.h"
+#include "utap/network.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace UTAP;
+using std::string;
+using std::cerr;
+using std::endl;
+
+static int failures = 0;
+
+static void expect(bool condition, const string &model, const char *what)
+{
+    if (!condition)
+    {
+        cerr << "FAIL: " << model << ": " << what << endl;
+        failures++;
+    }
+}
+
+/** Checks that \a id is the id of \a expr in the network. */
+static bool same(const Network &network, int32_t id, const expression_t &expr)
+{
+    if (expr.empty())
+    {
+        return id == Network::NONE;
+    }
+    return id >= 0 && (size_t)id < network.getExpressionCount()
+        && network.getExpression(id) == expr;
+}
+
+static void check(const string &model)
+{
+    TimedAutomataSystem system;
+    if (model.size() >= 4 && model.compare(model.size() - 4, 4, ".xml") == 0)
+    {
+        parseXMLFile(model.c_str(), &system, true);
+    }
+    else
+    {
+        FILE *file = fopen(model.c_str(), "r");
+        if (file == NULL)
+        {
+            perror(model.c_str());
+            exit(EXIT_FAILURE);
+        }
+        parseXTA(file, &system, true);
+        fclose(file);
+    }
+    if (system.hasErrors())
+    {
+        expect(false, model, "model has errors");
+        return;
+    }
+
+    Network network(system);
+    expect(network.getProcessCount() == system.getProcesses().size(),
+           model, "wrong number of processes");
+
+    int32_t p = 0, l = 0, e = 0;
+    for (auto& process: system.getProcesses())
+    {
+        template_t *templ = process.templ;
+        expect(network.getProcessInstance(p) == &process, model, "wrong instance");
+        expect(network.getProcessFirstLocation(p) == l, model, "wrong first location");
+        expect(network.getProcessFirstEdge(p) == e, model, "wrong first edge");
+        expect(network.getProcessInitial(p) == (templ->init == symbol_t()
+               ? Network::NONE
+               : l + static_cast<state_t*>(templ->init.getData())->locNr),
+               model, "wrong initial location");
+
+        for (auto& state: templ->states)
+        {
+            type_t type = state.uid.getType();
+            expect(network.getLocationState(l) == &state, model, "wrong location");
+            expect(network.getLocationProcess(l) == p, model, "wrong location process");
+            expect(network.getLocationFlags(l)
+                   == (type.is(Constants::URGENT) ? Network::URGENT
+                       : type.is(Constants::COMMITTED) ? Network::COMMITTED
+                       : Network::NORMAL), model, "wrong location flags");
+            expect(same(network, network.getLocationInvariant(l), state.invariant),
+                   model, "wrong invariant");
+            l++;
+        }
+        int32_t first = network.getProcessFirstLocation(p);
+        for (auto& edge: templ->edges)
+        {
+            expect(network.getEdge(e) == &edge, model, "wrong edge");
+            expect(network.getEdgeProcess(e) == p, model, "wrong edge process");
+            expect(network.getEdgeSource(e)
+                   == (edge.src ? first + edge.src->locNr : Network::NONE),
+                   model, "wrong source");
+            expect(network.getEdgeTarget(e)
+                   == (edge.dst ? first + edge.dst->locNr : Network::NONE),
+                   model, "wrong target");
+            expect(same(network, network.getEdgeGuard(e), edge.guard),
+                   model, "wrong guard");
+            expect(same(network, network.getEdgeSync(e), edge.sync),
+                   model, "wrong synchronisation");
+            expect(same(network, network.getEdgeUpdate(e), edge.assign),
+                   model, "wrong update");
+            expect(network.isEdgeControllable(e) == edge.control,
+                   model, "wrong controllability");
+            e++;
+        }
+        p++;
+    }
+    expect(network.getProcessFirstLocation(p) == l, model, "wrong end of locations");
+    expect(network.getProcessFirstEdge(p) == e, model, "wrong end of edges");
+    expect(network.getLocationCount() == (size_t)l, model, "wrong number of locations");
+    expect(network.getEdgeCount() == (size_t)e, model, "wrong number of edges");
+}
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        check(argv[i]);
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
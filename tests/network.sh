@@ -0,0 +1,11 @@
+#!/bin/sh
+# Checks the network of the processes of generated XML and XTA models
+# and of the models in models/.
+
+status=0
+"$MODELGEN" -s 1 -t 16 -p 64 -F 16 -C 4 -q 4 -L 4 network-model.xml || exit 1
+"$MODELGEN" -f xta -s 2 -t 8 -p 32 -F 8 -C 4 network-model.xta || exit 1
+./network network-model.xml network-model.xta "$srcdir"/models/*.xml \
+    "$srcdir"/models/*.xta || status=1
+rm -f network-model.xml network-model.xta
+exit $status
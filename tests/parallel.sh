@@ -0,0 +1,43 @@
+#!/bin/sh
+# Checks that type checking on several threads reports the same errors
+# and warnings, in the same order, as type checking on one thread. The
+# models in errors/ must have errors or warnings.
+#
+# Workers share the types and expressions reachable from several
+# templates and instances (see models/sharing.xta). To check for data
+# races, configure with CXXFLAGS="-g -fsanitize=thread" and
+# LDFLAGS=-fsanitize=thread: a report makes the exit status or the
+# output of the parallel run differ, which fails this test. Which
+# tasks end up on different threads depends on timing, so the parallel
+# check is repeated.
+
+generated=parallel-model.xml
+"$MODELGEN" -s 1 -t 16 -p 64 -F 16 -C 4 -q 4 -L 4 $generated || exit 1
+
+status=0
+for model in "$srcdir"/models/*.xta "$srcdir"/errors/*.xta $generated; do
+    [ -f "$model" ] || continue
+    "$SYNTAXCHECK" "$model" >parallel-serial.out 2>&1
+    serial=$?
+    for run in 1 2 3 4 5 6 7 8; do
+        "$SYNTAXCHECK" -j 4 "$model" >parallel-parallel.out 2>&1
+        parallel=$?
+        if [ $serial -ne $parallel ] \
+            || ! cmp -s parallel-serial.out parallel-parallel.out; then
+            echo "FAIL: $model differs when checked on 4 threads" >&2
+            diff parallel-serial.out parallel-parallel.out >&2
+            status=1
+            break
+        fi
+    done
+    case "$model" in
+    */errors/*)
+        if [ $serial -ne 2 ]; then
+            echo "FAIL: $model has no errors or warnings" >&2
+            status=1
+        fi
+        ;;
+    esac
+done
+rm -f $generated parallel-serial.out parallel-parallel.out
+exit $status
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Checks that pretty prints every model in models/ and two generated
+# models as given by the .out files in pretty/, which were written by
+# the pretty printer before it built its output as text trees.
+
+status=0
+check() {
+    "$PRETTY" "$1" >pretty.out 2>&1
+    if ! cmp -s "$2" pretty.out; then
+        echo "FAIL: $1" >&2
+        diff "$2" pretty.out >&2
+        status=1
+    fi
+}
+
+for model in "$srcdir"/models/*.xta "$srcdir"/models/*.xml; do
+    [ -f "$model" ] || continue
+    name=`basename "$model"`
+    check "$model" "$srcdir/pretty/${name%.*}.out"
+done
+
+"$MODELGEN" -s 3 -t 6 -p 10 -F 4 -C 4 -q 3 pretty-model.xml || exit 1
+"$MODELGEN" -f xta -s 4 -t 6 -p 10 -F 4 -C 4 pretty-model.xta || exit 1
+check pretty-model.xml "$srcdir"/pretty/generated-xml.out
+check pretty-model.xta "$srcdir"/pretty/generated-xta.out
+rm -f pretty.out pretty-model.xml pretty-model.xta
+exit $status
@@ -0,0 +1,294 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks the statistics of loading a model: for every model given on
+ * the command line, loading it with statistics enabled must spend
+ * time in each phase (except XML reading for XTA models), count the
+ * objects and bytes of each kind, and count the errors and warnings
+ * of the system. writeJSON() must write valid JSON with an entry for
+ * every phase and counter. Without statistics nothing is recorded.
+ *
+ * Model names ending in .xml are parsed as XML, all others as XTA.
+ */
+
+#include "utap/utap.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace UTAP;
+using std::string;
+using std::cerr;
+using std::endl;
+
+static int failures = 0;
+
+static void fail(const string &model, const string &what)
+{
+    cerr << "FAIL: " << model << ": " << what << endl;
+    failures++;
+}
+
+/** A recogniser of JSON texts (RFC 8259). */
+class JSON
+{
+private:
+    const string &text;
+    size_t pos{0};
+
+    void space()
+    {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t'
+                                     || text[pos] == '\n' || text[pos] == '\r'))
+            pos++;
+    }
+
+    bool literal(const char *word)
+    {
+        size_t len = strlen(word);
+        if (text.compare(pos, len, word) != 0)
+            return false;
+        pos += len;
+        return true;
+    }
+
+    bool digits()
+    {
+        size_t start = pos;
+        while (pos < text.size() && isdigit((unsigned char)text[pos]))
+            pos++;
+        return pos > start;
+    }
+
+    bool number()
+    {
+        if (pos < text.size() && text[pos] == '-')
+            pos++;
+        if (pos < text.size() && text[pos] == '0')
+            pos++;
+        else if (!digits())
+            return false;
+        if (pos < text.size() && text[pos] == '.')
+        {
+            pos++;
+            if (!digits())
+                return false;
+        }
+        if (pos < text.size() && (text[pos] == 'e' || text[pos] == 'E'))
+        {
+            pos++;
+            if (pos < text.size() && (text[pos] == '+' || text[pos] == '-'))
+                pos++;
+            if (!digits())
+                return false;
+        }
+        return true;
+    }
+
+    bool str()
+    {
+        if (!literal("\""))
+            return false;
+        while (pos < text.size() && text[pos] != '"')
+        {
+            if ((unsigned char)text[pos] < 0x20)
+                return false;
+            if (text[pos] == '\\')
+            {
+                pos++;
+                if (pos >= text.size() || text[pos] == '\0'
+                    || !strchr("\"\\/bfnrtu", text[pos]))
+                    return false;
+            }
+            pos++;
+        }
+        return literal("\"");
+    }
+
+    bool members(char close, bool named)
+    {
+        space();
+        if (pos < text.size() && text[pos] == close)
+        {
+            pos++;
+            return true;
+        }
+        for (;;)
+        {
+            if (named)
+            {
+                space();
+                if (!str())
+                    return false;
+                space();
+                if (!literal(":"))
+                    return false;
+            }
+            if (!value())
+                return false;
+            space();
+            if (literal(","))
+                continue;
+            return literal(close == '}' ? "}" : "]");
+        }
+    }
+
+    bool value()
+    {
+        space();
+        if (literal("{"))
+            return members('}', true);
+        if (literal("["))
+            return members(']', false);
+        if (pos < text.size() && text[pos] == '"')
+            return str();
+        return literal("true") || literal("false") || literal("null") || number();
+    }
+
+public:
+    explicit JSON(const string &text) : text(text) {}
+
+    /** Returns true if the whole text is a single JSON value. */
+    bool valid()
+    {
+        if (!value())
+            return false;
+        space();
+        return pos == text.size();
+    }
+};
+
+static bool parse(const string &model, TimedAutomataSystem &system)
+{
+    if (model.size() >= 4 && model.compare(model.size() - 4, 4, ".xml") == 0)
+    {
+        parseXMLFile(model.c_str(), &system, true);
+        return true;
+    }
+    FILE *file = fopen(model.c_str(), "r");
+    if (file == NULL)
+    {
+        perror(model.c_str());
+        exit(EXIT_FAILURE);
+    }
+    parseXTA(file, &system, true);
+    fclose(file);
+    return false;
+}
+
+static void check(const string &model)
+{
+    TimedAutomataSystem plain;
+    parse(model, plain);
+    if (plain.getStatistics() != NULL)
+    {
+        fail(model, "statistics are enabled by default");
+    }
+
+    TimedAutomataSystem system;
+    system.setStatisticsEnabled(true);
+    bool xml = parse(model, system);
+    const Statistics *statistics = system.getStatistics();
+    if (statistics == NULL)
+    {
+        fail(model, "statistics are not enabled");
+        return;
+    }
+
+    for (int i = 0; i < Statistics::PHASES; i++)
+    {
+        Statistics::phase_t phase = (Statistics::phase_t)i;
+        double time = statistics->getTime(phase);
+        if ((phase == Statistics::XML_READING && !xml) ? time != 0 : time <= 0)
+        {
+            fail(model, string("wrong time in phase ") + Statistics::getName(phase));
+        }
+    }
+    for (int i = 0; i < Statistics::COUNTERS; i++)
+    {
+        Statistics::counter_t counter = (Statistics::counter_t)i;
+        uint64_t expected = 0;
+        if (counter == Statistics::ERRORS)
+        {
+            expected = system.getErrors().size();
+        }
+        else if (counter == Statistics::WARNINGS)
+        {
+            expected = system.getWarnings().size();
+        }
+        bool exact = counter == Statistics::ERRORS || counter == Statistics::WARNINGS;
+        uint64_t count = statistics->getCount(counter);
+        uint64_t bytes = statistics->getBytes(counter);
+        if (exact ? count != expected : count == 0)
+        {
+            fail(model, string("wrong count of ") + Statistics::getName(counter));
+        }
+        if (count == 0 ? bytes != 0 : bytes < count)
+        {
+            fail(model, string("wrong bytes of ") + Statistics::getName(counter));
+        }
+    }
+
+    std::ostringstream out;
+    statistics->writeJSON(out);
+    string json = out.str();
+    if (!JSON(json).valid())
+    {
+        fail(model, "writeJSON() writes invalid JSON: " + json);
+    }
+    for (int i = 0; i < Statistics::PHASES; i++)
+    {
+        string name = string("\"") + Statistics::getName((Statistics::phase_t)i) + "\"";
+        if (json.find(name) == string::npos)
+        {
+            fail(model, "writeJSON() leaves out " + name);
+        }
+    }
+    for (int i = 0; i < Statistics::COUNTERS; i++)
+    {
+        string name = string("\"") + Statistics::getName((Statistics::counter_t)i) + "\"";
+        if (json.find(name) == string::npos)
+        {
+            fail(model, "writeJSON() leaves out " + name);
+        }
+    }
+
+    system.setStatisticsEnabled(false);
+    if (system.getStatistics() != NULL)
+    {
+        fail(model, "statistics cannot be disabled");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        check(argv[i]);
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
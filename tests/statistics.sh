@@ -0,0 +1,12 @@
+#!/bin/sh
+# Checks the statistics of loading generated XML and XTA models and
+# the models in models/ and errors/.
+
+status=0
+"$MODELGEN" -s 1 -t 16 -p 64 -F 16 -C 4 -q 4 -L 4 statistics-model.xml || exit 1
+"$MODELGEN" -f xta -s 2 -t 8 -p 32 -F 8 -C 4 statistics-model.xta || exit 1
+./statistics statistics-model.xml statistics-model.xta \
+    "$srcdir"/models/*.xta "$srcdir"/models/*.xml \
+    "$srcdir"/errors/*.xta "$srcdir"/errors/*.xml || status=1
+rm -f statistics-model.xml statistics-model.xta
+exit $status
@@ -0,0 +1,172 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks that writing a system with writeXMLBuffer() does not leak:
+ * once the first write has initialised libxml2 and sized the buffer,
+ * further writes of the same system must free everything they
+ * allocate, both through operator new and through libxml2.
+ */
+
+#include "utap/utap.h"
+
+#include <libxml/xmlmemory.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <string>
+
+using namespace UTAP;
+using std::string;
+using std::cerr;
+using std::endl;
+
+/*
+ * Allocations are counted as in bench.cpp by replacing the global
+ * operator new and the allocation functions of libxml2, but frees are
+ * counted too, such that the number of live allocations is known.
+ */
+#ifdef __GNUC__
+#define OUT_OF_LINE __attribute__((noinline))
+#else
+#define OUT_OF_LINE
+#endif
+
+static long allocations = 0;
+static long frees = 0;
+
+OUT_OF_LINE void *operator new(size_t size)
+{
+    allocations++;
+    void *p = malloc(size ? size : 1);
+    if (p == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+OUT_OF_LINE void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+OUT_OF_LINE void operator delete(void *p) noexcept
+{
+    if (p)
+    {
+        frees++;
+        free(p);
+    }
+}
+
+OUT_OF_LINE void operator delete[](void *p) noexcept
+{
+    operator delete(p);
+}
+
+OUT_OF_LINE void operator delete(void *p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+OUT_OF_LINE void operator delete[](void *p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+static void xmlCountingFree(void *p)
+{
+    if (p)
+    {
+        frees++;
+        free(p);
+    }
+}
+
+static void *xmlCountingMalloc(size_t size)
+{
+    allocations++;
+    return malloc(size);
+}
+
+static void *xmlCountingRealloc(void *p, size_t size)
+{
+    if (p == NULL)
+    {
+        allocations++;
+    }
+    return realloc(p, size);
+}
+
+static char *xmlCountingStrdup(const char *s)
+{
+    allocations++;
+    return strdup(s);
+}
+
+static const int WRITES = 8;
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        cerr << "Usage: " << argv[0] << " <model.xml>" << endl;
+        return EXIT_FAILURE;
+    }
+    xmlMemSetup(xmlCountingFree, xmlCountingMalloc, xmlCountingRealloc,
+                xmlCountingStrdup);
+
+    TimedAutomataSystem system;
+    parseXMLFile(argv[1], &system, true);
+    if (system.hasErrors())
+    {
+        cerr << argv[1] << ": model has errors" << endl;
+        return EXIT_FAILURE;
+    }
+
+    string buffer;
+    if (writeXMLBuffer(buffer, &system) < 0)
+    {
+        cerr << argv[1] << ": writeXMLBuffer failed" << endl;
+        return EXIT_FAILURE;
+    }
+    size_t size = buffer.size();
+
+    long live = allocations - frees;
+    long before = allocations;
+    for (int i = 0; i < WRITES; i++)
+    {
+        writeXMLBuffer(buffer, &system);
+    }
+    long growth = allocations - frees - live;
+    if (buffer.size() != size || growth != 0)
+    {
+        cerr << argv[1] << ": " << WRITES << " writes of " << size
+             << " bytes made " << (allocations - before)
+             << " allocations of which " << growth << " were not freed"
+             << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,11 @@
+#!/bin/sh
+# Checks that writing a generated model back to XML does not leak
+# memory.
+
+generated=writememory-model.xml
+"$MODELGEN" -s 1 -t 16 -p 64 -F 16 -C 4 -q 4 -L 4 $generated || exit 1
+
+./writememory $generated
+status=$?
+rm -f $generated
+exit $status
@@ -0,0 +1,217 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks the destinations of the XML writer: for every model given on
+ * the command line, writing the system with writeXMLFile(),
+ * writeXMLBuffer() and writeXMLStream() to a file and to a pipe must
+ * give the same bytes, with and without XML_NO_INDENT. The output
+ * without indentation must have no indentation and must parse back
+ * into a system which is written like the original.
+ */
+
+#include "utap/utap.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace UTAP;
+using std::string;
+using std::cerr;
+using std::endl;
+
+static const char *scratch = "writexml-model.tmp";
+
+static int failures = 0;
+
+static string readFile(const string &name)
+{
+    std::ifstream file(name.c_str(), std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot read " + name);
+    }
+    std::ostringstream out;
+    out << file.rdbuf();
+    return out.str();
+}
+
+/** Returns the system written by writeXMLFile(). */
+static string writeFile(TimedAutomataSystem &system, int options)
+{
+    writeXMLFile(scratch, &system, options);
+    return readFile(scratch);
+}
+
+/** Returns the system written by writeXMLStream() to a file. */
+static string writeStream(TimedAutomataSystem &system, int options)
+{
+    int fd = open(scratch, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Cannot write " + string(scratch));
+    }
+    writeXMLStream(fd, &system, options);
+    close(fd);
+    return readFile(scratch);
+}
+
+/**
+ * Returns the system written by writeXMLStream() to a pipe, which is
+ * read by another thread as the output can be larger than the pipe.
+ */
+static string writePipe(TimedAutomataSystem &system, int options)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        throw std::runtime_error("Cannot create a pipe");
+    }
+    string result;
+    std::thread reader([&]() {
+            char buffer[4096];
+            ssize_t n;
+            while ((n = read(fds[0], buffer, sizeof(buffer))) > 0)
+            {
+                result.append(buffer, n);
+            }
+        });
+    writeXMLStream(fds[1], &system, options);
+    close(fds[1]);
+    reader.join();
+    close(fds[0]);
+    return result;
+}
+
+static string writeBuffer(TimedAutomataSystem &system, int options)
+{
+    string buffer;
+    writeXMLBuffer(buffer, &system, options);
+    return buffer;
+}
+
+/**
+ * Returns true if some element after the XML declaration and the
+ * document type starts on a line of its own.
+ */
+static bool indented(const string &text)
+{
+    size_t start = text.find("<nta>");
+    for (size_t i = text.find('>', start); i != string::npos; i = text.find('>', i + 1))
+    {
+        size_t j = text.find_first_not_of(" \t\n", i + 1);
+        if (j != string::npos && text[j] == '<'
+            && text.find('\n', i + 1) < j)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void fail(const string &model, const string &what)
+{
+    cerr << "FAIL: " << model << ": " << what << endl;
+    failures++;
+}
+
+static void check(const string &model)
+{
+    TimedAutomataSystem system;
+    parseXMLFile(model.c_str(), &system, true);
+    if (system.hasErrors())
+    {
+        fail(model, "model has errors");
+        return;
+    }
+
+    const int options[] = { XML_NO_OPTIONS, XML_NO_INDENT };
+    for (int option: options)
+    {
+        string what = option == XML_NO_INDENT ? "without indentation" : "indented";
+        string buffer = writeBuffer(system, option);
+        if (buffer.empty())
+        {
+            fail(model, "nothing written " + what);
+        }
+        if (writeFile(system, option) != buffer)
+        {
+            fail(model, "writeXMLFile differs " + what);
+        }
+        if (writeStream(system, option) != buffer)
+        {
+            fail(model, "writeXMLStream to a file differs " + what);
+        }
+        if (writePipe(system, option) != buffer)
+        {
+            fail(model, "writeXMLStream to a pipe differs " + what);
+        }
+    }
+
+    string indent = writeBuffer(system, XML_NO_OPTIONS);
+    string flat = writeBuffer(system, XML_NO_INDENT);
+    if (!indented(indent))
+    {
+        fail(model, "indented output has no indentation");
+    }
+    if (indented(flat))
+    {
+        fail(model, "output without indentation is indented");
+    }
+
+    TimedAutomataSystem reparsed;
+    parseXMLBuffer(flat.c_str(), &reparsed, true);
+    if (reparsed.hasErrors())
+    {
+        fail(model, "output without indentation has errors");
+    }
+    else if (writeBuffer(reparsed, XML_NO_OPTIONS) != indent)
+    {
+        fail(model, "output without indentation parses differently");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            check(argv[i]);
+        }
+    }
+    catch (std::exception &e)
+    {
+        cerr << "FAIL: " << e.what() << endl;
+        failures++;
+    }
+    remove(scratch);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
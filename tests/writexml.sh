@@ -0,0 +1,12 @@
+#!/bin/sh
+# Checks that writing models to files, buffers and pipes gives the
+# same XML, and that XML written without indentation parses back.
+# The generated model is larger than the buffer of a pipe.
+
+generated=writexml-model.xml
+"$MODELGEN" -s 1 -t 16 -p 64 -F 16 -C 4 -q 4 -L 4 $generated || exit 1
+
+./writexml $generated "$srcdir"/models/*.xml
+status=$?
+rm -f $generated
+exit $status
@@ -0,0 +1,176 @@
+// -*- mode: C++; c-file-style: "stroustrup"; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+
+/* libutap - Uppaal Timed Automata Parser.
+   Copyright (C) 2020 Aalborg University.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 2.1 of
+   the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA
+*/
+
+/*
+ * Checks that the XML parse options give the same system as a full
+ * parse: for every model given on the command line, the system parsed
+ * with XML_SKIP_LAYOUT must write the same XML and give the same
+ * errors and warnings as the system parsed without options. With
+ * XML_LAZY_TEMPLATES, on its own and together with XML_SKIP_LAYOUT,
+ * the same must hold except that templates without processes may be
+ * left out.
+ */
+
+#include "utap/utap.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace UTAP;
+using std::string;
+using std::vector;
+using std::cerr;
+using std::endl;
+
+static int failures = 0;
+
+/** The outcome of parsing a model. */
+struct result_t
+{
+    string head;                /**< The XML written before the templates */
+    vector<string> templates;   /**< The XML written for each template */
+    vector<string> names;       /**< The names of the templates */
+    string tail;                /**< The XML written after the templates */
+    vector<string> diagnostics; /**< Errors and warnings as text */
+    std::set<string> used;      /**< Templates of processes */
+};
+
+static result_t parse(const string &name, int options)
+{
+    result_t result;
+    TimedAutomataSystem system;
+    try
+    {
+        parseXMLFile(name.c_str(), &system, true, options);
+    }
+    catch (std::exception &e)
+    {
+        result.diagnostics.push_back(string("exception: ") + e.what());
+        return result;
+    }
+
+    string xml;
+    writeXMLBuffer(xml, &system);
+    size_t begin = xml.find("<template>");
+    result.head = xml.substr(0, begin);
+    while (begin != string::npos)
+    {
+        size_t end = xml.find("</template>", begin) + strlen("</template>");
+        result.templates.push_back(xml.substr(begin, end - begin));
+        result.tail = xml.substr(end);
+        begin = xml.find("<template>", end);
+    }
+    for (auto& t: system.getTemplates())
+    {
+        if (t.isTA)
+        {
+            result.names.push_back(t.uid.getName());
+        }
+    }
+    for (auto& p: system.getProcesses())
+    {
+        result.used.insert(p.templ->uid.getName());
+    }
+
+    for (const UTAP::error_t &e: system.getErrors())
+    {
+        std::ostringstream out;
+        out << "error: " << e << " " << e.context;
+        result.diagnostics.push_back(out.str());
+    }
+    for (const UTAP::error_t &w: system.getWarnings())
+    {
+        std::ostringstream out;
+        out << "warning: " << w << " " << w.context;
+        result.diagnostics.push_back(out.str());
+    }
+    return result;
+}
+
+static void fail(const string &model, const char *what, const char *problem)
+{
+    cerr << "FAIL: " << model << ": " << what << ": " << problem << endl;
+    failures++;
+}
+
+/**
+ * Compares the result of parsing with options with the full parse.
+ * If lazy is set, templates without processes may be left out.
+ */
+static void check(const string &model, const char *what, int options,
+                  const result_t &full, bool lazy)
+{
+    result_t result = parse(model, options);
+    if (result.names.size() != result.templates.size()
+        || full.names.size() != full.templates.size())
+    {
+        fail(model, what, "written templates do not match the system");
+        return;
+    }
+    if (result.head != full.head || result.tail != full.tail)
+    {
+        fail(model, what, "different declarations or processes");
+    }
+    if (result.diagnostics != full.diagnostics)
+    {
+        fail(model, what, "different errors or warnings");
+    }
+    size_t i = 0;
+    for (size_t j = 0; j < full.templates.size(); j++)
+    {
+        if (i < result.templates.size() && result.names[i] == full.names[j])
+        {
+            if (result.templates[i] != full.templates[j])
+            {
+                fail(model, what, "different templates");
+            }
+            i++;
+        }
+        else if (!lazy || full.used.count(full.names[j]))
+        {
+            fail(model, what, "a template is missing");
+        }
+    }
+    if (i != result.templates.size())
+    {
+        fail(model, what, "templates in a different order");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        string model = argv[i];
+        result_t full = parse(model, XML_NO_OPTIONS);
+        check(model, "skip layout", XML_SKIP_LAYOUT, full, false);
+        check(model, "lazy templates", XML_LAZY_TEMPLATES, full, true);
+        check(model, "lazy templates without layout",
+              XML_LAZY_TEMPLATES | XML_SKIP_LAYOUT, full, true);
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
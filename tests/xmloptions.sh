@@ -0,0 +1,11 @@
+#!/bin/sh
+# Checks that parsing XML models with XML_SKIP_LAYOUT and
+# XML_LAZY_TEMPLATES gives the same system as a full parse.
+
+generated=xmloptions-model.xml
+"$MODELGEN" -s 1 -t 16 -p 12 -F 16 -C 4 -q 4 -L 4 $generated || exit 1
+
+./xmloptions $generated "$srcdir"/models/*.xml "$srcdir"/errors/*.xml
+status=$?
+rm -f $generated
+exit $status